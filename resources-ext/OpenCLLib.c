@@ -15,8 +15,24 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 #include <string.h>
 
+#ifdef WINDOWS
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+#include <pthread.h>
+
 //openCL headers
 #include <CL/cl_platform.h>
 #include <CL/cl.h>
@@ -27,12 +43,33 @@
 #include "dana_api_1.7/nli_util.h"
 #include "dana_api_1.7/vmi_util.h"
 
+//element types. UINT is the original int type: size_t arrays and
+//uint32 matrices. The sized types are stored as named on the device
 #define FLOAT 0
 #define UINT 1
+#define DOUBLE 2
+#define HALF 3
+#define INT8 4
+#define UINT8 5
+#define INT16 6
+#define UINT16 7
+#define INT32 8
+#define UINT32 9
+#define INT64 10
+#define UINT64 11
+
+#define MEM_DEVICE 0
+#define MEM_MAPPED 1
+
+#define LAYOUT_IMAGE 0
+#define LAYOUT_BUFFER 1
 
 #define MAX_PLATFORMS 100
 #define MAX_DEVICES 100
 
+#define BINARY_CACHE_ENV "DANA_OPENCL_CACHE"
+#define BINARY_CACHE_MAGIC 0x4c4342444e4144ULL
+
 static CoreAPI *api;
 
 static GlobalTypeLink* intArrayGT = NULL;
@@ -44,6 +81,8 @@ static GlobalTypeLink* decMatrixGT = NULL;
 static GlobalTypeLink* decArrayGT = NULL;
 
 uint8_t alreadyInitFlag = 0;
+//set by init() when there is no OpenCL platform, leaving only the host device
+uint8_t noPlatforms = 0;
 
 /*
  * these global variables are set in init()
@@ -71,12 +110,316 @@ typedef struct _context_list_item {
     struct _context_list_item* next;
 } CONTEXT_LI;
 
+/*
+ * Released memory objects are parked in a pool rather than
+ * handed back to the driver, so that the create -> write -> run
+ * -> read -> destroy pattern used by the apps recycles the same
+ * cl_mem objects instead of calling clCreateBuffer/clCreateImage
+ * every time. Buffers are binned into size classes, images are
+ * only reused for an exact format and shape match.
+ */
+#define POOL_MIN_CLASS 256
+#define POOL_DEFAULT_LIMIT ((size_t) 256*1024*1024)
+
+typedef struct _pool_list_item {
+    cl_mem memObj;
+    cl_context context;
+    cl_mem_object_type kind;
+    cl_mem_flags flags;
+    size_t size;
+    size_t width;
+    size_t height;
+    cl_image_format format;
+    struct _pool_list_item* next;
+} POOL_LI;
+
 typedef struct _one_per_dana_comp {
     CONTEXT_LI* contexts;
+    //guards the pool and its counters, which every thread using the context space shares
+    pthread_mutex_t poolLock;
+    POOL_LI* pool;
+    size_t poolLimit;
+    size_t poolHits;
+    size_t poolMisses;
+    size_t poolBytesRetained;
+    size_t poolObjectsRetained;
 } DANA_COMP;
 
+/*
+ * The last non-blocking command enqueued on each memory object. A
+ * released object whose command hasn't completed goes back to the
+ * driver, which frees it once the command is done, rather than into
+ * the pool, where a new owner could write it while the command still
+ * reads or writes it. Entries of completed commands are dropped as
+ * new ones are added
+ */
+typedef struct _busy_list_item {
+    cl_mem memObj;
+    cl_event event;
+    struct _busy_list_item* next;
+} BUSY_LI;
+
+BUSY_LI* busyList = NULL;
+pthread_mutex_t busyLock = PTHREAD_MUTEX_INITIALIZER;
+
+uint8_t eventPending(cl_event event) {
+    cl_int status = CL_COMPLETE;
+    clGetEventInfo(event, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(cl_int), &status, NULL);
+    return status > CL_COMPLETE;
+}
+
+void markBusy(cl_mem memObj, cl_event event) {
+    if (event == NULL) {
+        return;
+    }
+    clRetainEvent(event);
+    pthread_mutex_lock(&busyLock);
+    uint8_t found = 0;
+    BUSY_LI* prev = NULL;
+    BUSY_LI* probe = busyList;
+    while (probe != NULL) {
+        BUSY_LI* next = probe->next;
+        if (probe->memObj == memObj) {
+            clReleaseEvent(probe->event);
+            probe->event = event;
+            found = 1;
+            prev = probe;
+        }
+        else if (!eventPending(probe->event)) {
+            if (prev == NULL) {
+                busyList = next;
+            }
+            else {
+                prev->next = next;
+            }
+            clReleaseEvent(probe->event);
+            free(probe);
+        }
+        else {
+            prev = probe;
+        }
+        probe = next;
+    }
+    if (!found) {
+        BUSY_LI* item = (BUSY_LI*) malloc(sizeof(BUSY_LI));
+        item->memObj = memObj;
+        item->event = event;
+        item->next = busyList;
+        busyList = item;
+    }
+    pthread_mutex_unlock(&busyLock);
+}
+
+/*
+ * Forgets memObj, which is being released. Returns 1 if its last
+ * non-blocking command hadn't completed
+ */
+uint8_t takeBusy(cl_mem memObj) {
+    uint8_t pending = 0;
+    pthread_mutex_lock(&busyLock);
+    BUSY_LI* prev = NULL;
+    for (BUSY_LI* probe = busyList; probe != NULL; probe = probe->next) {
+        if (probe->memObj == memObj) {
+            if (prev == NULL) {
+                busyList = probe->next;
+            }
+            else {
+                prev->next = probe->next;
+            }
+            pending = eventPending(probe->event);
+            clReleaseEvent(probe->event);
+            free(probe);
+            break;
+        }
+        prev = probe;
+    }
+    pthread_mutex_unlock(&busyLock);
+    return pending;
+}
+
+/*
+ * Rounds a buffer size up to its size class. Classes are powers
+ * of two split into quarters, so at most 25% of a buffer is wasted
+ */
+size_t poolSizeClass(size_t size) {
+    if (size <= POOL_MIN_CLASS) {
+        return POOL_MIN_CLASS;
+    }
+    size_t pow = POOL_MIN_CLASS;
+    while (pow*2 < size) {
+        pow *= 2;
+    }
+    size_t step = pow/4;
+    size_t sizeClass = pow;
+    while (sizeClass < size) {
+        sizeClass += step;
+    }
+    return sizeClass;
+}
+
+POOL_LI* poolTake(DANA_COMP* danaComp, cl_context context, cl_mem_object_type kind, cl_mem_flags flags, size_t size, size_t width, size_t height, cl_image_format* format) {
+    POOL_LI* prev = NULL;
+    for (POOL_LI* probe = danaComp->pool; probe != NULL; probe = probe->next) {
+        uint8_t match = probe->context == context && probe->kind == kind && probe->flags == flags;
+        if (match && kind == CL_MEM_OBJECT_BUFFER) {
+            match = probe->size == size;
+        }
+        else if (match) {
+            match = probe->width == width && probe->height == height
+                && probe->format.image_channel_order == format->image_channel_order
+                && probe->format.image_channel_data_type == format->image_channel_data_type;
+        }
+        if (match) {
+            if (prev == NULL) {
+                danaComp->pool = probe->next;
+            }
+            else {
+                prev->next = probe->next;
+            }
+            danaComp->poolBytesRetained -= probe->size;
+            danaComp->poolObjectsRetained--;
+            return probe;
+        }
+        prev = probe;
+    }
+    return NULL;
+}
+
+/*
+ * Releases pooled objects to the driver until the pool retains
+ * at most 'limit' bytes. The most recently parked objects are
+ * kept first, as they are the likeliest to be asked for again
+ */
+void poolTrim(DANA_COMP* danaComp, size_t limit) {
+    POOL_LI* evicted = NULL;
+    pthread_mutex_lock(&danaComp->poolLock);
+    size_t kept = 0;
+    POOL_LI** link = &danaComp->pool;
+    while (*link != NULL) {
+        POOL_LI* probe = *link;
+        if (kept + probe->size <= limit) {
+            kept += probe->size;
+            link = &probe->next;
+        }
+        else {
+            *link = probe->next;
+            probe->next = evicted;
+            evicted = probe;
+            danaComp->poolBytesRetained -= probe->size;
+            danaComp->poolObjectsRetained--;
+        }
+    }
+    pthread_mutex_unlock(&danaComp->poolLock);
+    while (evicted != NULL) {
+        POOL_LI* next = evicted->next;
+        clReleaseMemObject(evicted->memObj);
+        free(evicted);
+        evicted = next;
+    }
+}
+
+cl_mem poolAcquireBuffer(DANA_COMP* danaComp, cl_context context, cl_mem_flags flags, size_t size, cl_int* CL_err) {
+    size_t sizeClass = poolSizeClass(size);
+    pthread_mutex_lock(&danaComp->poolLock);
+    POOL_LI* item = poolTake(danaComp, context, CL_MEM_OBJECT_BUFFER, flags, sizeClass, 0, 0, NULL);
+    if (item != NULL) {
+        danaComp->poolHits++;
+    }
+    else {
+        danaComp->poolMisses++;
+    }
+    pthread_mutex_unlock(&danaComp->poolLock);
+    if (item != NULL) {
+        cl_mem memObj = item->memObj;
+        free(item);
+        *CL_err = CL_SUCCESS;
+        return memObj;
+    }
+    cl_mem memObj = clCreateBuffer(context, flags, sizeClass, NULL, CL_err);
+    //the driver may be out of memory only because the pool is holding it
+    if (*CL_err == CL_MEM_OBJECT_ALLOCATION_FAILURE) {
+        poolTrim(danaComp, 0);
+        memObj = clCreateBuffer(context, flags, sizeClass, NULL, CL_err);
+    }
+    return memObj;
+}
+
+cl_mem poolAcquireImage(DANA_COMP* danaComp, cl_context context, cl_mem_flags flags, cl_image_format* format, cl_image_desc* desc, cl_int* CL_err) {
+    pthread_mutex_lock(&danaComp->poolLock);
+    POOL_LI* item = poolTake(danaComp, context, CL_MEM_OBJECT_IMAGE2D, flags, 0, desc->image_width, desc->image_height, format);
+    if (item != NULL) {
+        danaComp->poolHits++;
+    }
+    else {
+        danaComp->poolMisses++;
+    }
+    pthread_mutex_unlock(&danaComp->poolLock);
+    if (item != NULL) {
+        cl_mem memObj = item->memObj;
+        free(item);
+        *CL_err = CL_SUCCESS;
+        return memObj;
+    }
+    cl_mem memObj = clCreateImage(context, flags, format, desc, NULL, CL_err);
+    if (*CL_err == CL_MEM_OBJECT_ALLOCATION_FAILURE) {
+        poolTrim(danaComp, 0);
+        memObj = clCreateImage(context, flags, format, desc, NULL, CL_err);
+    }
+    return memObj;
+}
+
+/*
+ * Parks memObj in the pool, or releases it to the driver
+ * if retaining it would take the pool over its limit or it
+ * has a non-blocking command still pending.
+ * Returns the result of any clReleaseMemObject call made
+ */
+cl_int poolRelease(DANA_COMP* danaComp, cl_mem memObj) {
+    //the driver only frees an object once its pending commands are done
+    uint8_t busy = takeBusy(memObj);
+    //a sub-buffer's memory is its parent's, so there is nothing to keep
+    cl_mem parent = NULL;
+    clGetMemObjectInfo(memObj, CL_MEM_ASSOCIATED_MEMOBJECT, sizeof(cl_mem), &parent, NULL);
+    if (busy || parent != NULL) {
+        return clReleaseMemObject(memObj);
+    }
+    POOL_LI* item = (POOL_LI*) malloc(sizeof(POOL_LI));
+    cl_int CL_err = clGetMemObjectInfo(memObj, CL_MEM_TYPE, sizeof(cl_mem_object_type), &item->kind, NULL);
+    CL_err |= clGetMemObjectInfo(memObj, CL_MEM_CONTEXT, sizeof(cl_context), &item->context, NULL);
+    CL_err |= clGetMemObjectInfo(memObj, CL_MEM_FLAGS, sizeof(cl_mem_flags), &item->flags, NULL);
+    CL_err |= clGetMemObjectInfo(memObj, CL_MEM_SIZE, sizeof(size_t), &item->size, NULL);
+    if (CL_err == CL_SUCCESS && item->kind == CL_MEM_OBJECT_IMAGE2D) {
+        CL_err |= clGetImageInfo(memObj, CL_IMAGE_WIDTH, sizeof(size_t), &item->width, NULL);
+        CL_err |= clGetImageInfo(memObj, CL_IMAGE_HEIGHT, sizeof(size_t), &item->height, NULL);
+        CL_err |= clGetImageInfo(memObj, CL_IMAGE_FORMAT, sizeof(cl_image_format), &item->format, NULL);
+    }
+
+    if (CL_err == CL_SUCCESS && danaComp != NULL) {
+        pthread_mutex_lock(&danaComp->poolLock);
+        if (danaComp->poolBytesRetained + item->size <= danaComp->poolLimit) {
+            item->memObj = memObj;
+            item->next = danaComp->pool;
+            danaComp->pool = item;
+            danaComp->poolBytesRetained += item->size;
+            danaComp->poolObjectsRetained++;
+            pthread_mutex_unlock(&danaComp->poolLock);
+            return CL_SUCCESS;
+        }
+        pthread_mutex_unlock(&danaComp->poolLock);
+    }
+
+    free(item);
+    return clReleaseMemObject(memObj);
+}
+
 void destroyContexts(DANA_COMP* contextSpace) {
-    if (contextSpace == NULL || contextSpace->contexts == NULL) {
+    if (contextSpace == NULL) {
+        return;
+    }
+    poolTrim(contextSpace, 0);
+    pthread_mutex_destroy(&contextSpace->poolLock);
+    if (contextSpace->contexts == NULL) {
+        free(contextSpace);
         return;
     }
 
@@ -161,50 +504,257 @@ CONTEXT_LI* getContextByDevice(DANA_COMP* danaComp, cl_device_id device) {
     return NULL;
 }
 
-typedef struct _log_list_item {
-    char* APIFunctionCall;
-    int errorCode;
-    struct _log_list_item* next;
-}LOG_LI;
+//monotonic clock, in nanoseconds
+uint64_t nowNs() {
+#ifdef WINDOWS
+    LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t) ((now.QuadPart / freq.QuadPart) * 1000000000ULL + ((now.QuadPart % freq.QuadPart) * 1000000000ULL) / freq.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
 
-LOG_LI* logListHead = NULL;
-LOG_LI* logListEnd = NULL;
+/*
+ * Error log. Failed calls are recorded in a fixed ring of the last
+ * LOG_RING_SIZE entries (older ones are overwritten), with a count
+ * per error code kept for the life of the library. Recording takes
+ * no lock, so any thread may log: an entry's slot is claimed by
+ * taking the next sequence number, and its stamp is set from the
+ * sequence number once the fields are written, so readers skip
+ * slots that are mid-write or have been reused since. The call an
+ * entry names is one of a table of call names, added to (never
+ * removed from) as new ones are logged, so entries are fixed size
+ */
+#define LOG_RING_SIZE 256
+#define LOG_MAX_CALLS 256
+#define LOG_MAX_CODES 128
+//entry fields returned by getLogEntries
+#define LOG_FIELDS 5
+//a code slot not yet taken (see initLog)
+#define LOG_NO_CODE INT32_MIN
+
+typedef struct _log_entry {
+    //sequence number + 1 once written, 0 while being written
+    uint64_t stamp;
+    uint64_t timestamp;
+    size_t handle;
+    int32_t errorCode;
+    uint32_t call;
+} LOG_ENTRY;
+
+LOG_ENTRY logRing[LOG_RING_SIZE];
+uint64_t logNext = 0;
+const char* logCalls[LOG_MAX_CALLS];
+int32_t logCodes[LOG_MAX_CODES];
+uint64_t logCodeCounts[LOG_MAX_CODES];
+//entries whose call or code didn't fit the tables
+uint64_t logUntracked = 0;
+
+//called from load(), before anything can log
+void initLog() {
+    for (uint32_t i = 0; i < LOG_MAX_CODES; i++) {
+        logCodes[i] = LOG_NO_CODE;
+    }
+}
 
-LOG_LI* newLogItem(char* func, int err) {
-    LOG_LI* newLog = (LOG_LI*) malloc(sizeof(LOG_LI));
-    newLog->APIFunctionCall = func;
-    newLog->errorCode = err;
-    newLog->next = NULL;
-    return newLog;
+//index of the call name, adding it if it's new, or LOG_MAX_CALLS if the table is full
+uint32_t logCallIndex(const char* call) {
+    for (uint32_t i = 0; i < LOG_MAX_CALLS; i++) {
+        const char* at = __atomic_load_n(&logCalls[i], __ATOMIC_ACQUIRE);
+        if (at == NULL) {
+            const char* expected = NULL;
+            if (__atomic_compare_exchange_n(&logCalls[i], &expected, call, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                return i;
+            }
+            at = expected;
+        }
+        if (at == call || strcmp(at, call) == 0) {
+            return i;
+        }
+    }
+    return LOG_MAX_CALLS;
 }
 
-void addLog(LOG_LI* adding) {
-    if (logListHead == NULL) {
-        logListHead = adding;
-        logListEnd = adding;
-        return;
+void countLogCode(int32_t code) {
+    for (uint32_t i = 0; i < LOG_MAX_CODES; i++) {
+        int32_t at = __atomic_load_n(&logCodes[i], __ATOMIC_ACQUIRE);
+        if (at == LOG_NO_CODE) {
+            int32_t expected = LOG_NO_CODE;
+            if (__atomic_compare_exchange_n(&logCodes[i], &expected, code, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                at = code;
+            }
+            else {
+                at = expected;
+            }
+        }
+        if (at == code) {
+            __atomic_fetch_add(&logCodeCounts[i], 1, __ATOMIC_RELAXED);
+            return;
+        }
     }
+    __atomic_fetch_add(&logUntracked, 1, __ATOMIC_RELAXED);
+}
 
-    logListEnd->next = adding; 
-    logListEnd = adding;
-    return;
+/*
+ * Records that 'call' failed with 'err'. handle is the device,
+ * queue, memory object, program, kernel or event it failed on, 0 if
+ * none. call must outlive the library (a string literal)
+ */
+void addLog(const char* call, int err, void* handle) {
+    countLogCode(err);
+
+    uint32_t callIndex = logCallIndex(call);
+    if (callIndex == LOG_MAX_CALLS) {
+        __atomic_fetch_add(&logUntracked, 1, __ATOMIC_RELAXED);
+    }
+    uint64_t seq = __atomic_fetch_add(&logNext, 1, __ATOMIC_RELAXED);
+    LOG_ENTRY* entry = &logRing[seq % LOG_RING_SIZE];
+    __atomic_store_n(&entry->stamp, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&entry->timestamp, nowNs(), __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->handle, (size_t) handle, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->errorCode, (int32_t) err, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->call, callIndex, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stamp, seq + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Copies entry seq into copy, returning 0 if it has been overwritten
+ * or is still being written
+ */
+uint8_t readLogEntry(uint64_t seq, LOG_ENTRY* copy) {
+    LOG_ENTRY* entry = &logRing[seq % LOG_RING_SIZE];
+    if (__atomic_load_n(&entry->stamp, __ATOMIC_ACQUIRE) != seq + 1) {
+        return 0;
+    }
+    copy->timestamp = __atomic_load_n(&entry->timestamp, __ATOMIC_RELAXED);
+    copy->handle = __atomic_load_n(&entry->handle, __ATOMIC_RELAXED);
+    copy->errorCode = __atomic_load_n(&entry->errorCode, __ATOMIC_RELAXED);
+    copy->call = __atomic_load_n(&entry->call, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&entry->stamp, __ATOMIC_RELAXED) == seq + 1;
+}
+
+//sequence number of the oldest entry still in the ring
+uint64_t oldestLogEntry(uint64_t next) {
+    return next > LOG_RING_SIZE ? next - LOG_RING_SIZE : 0;
+}
+
+const char* logCallName(uint32_t call) {
+    if (call >= LOG_MAX_CALLS) {
+        return "?";
+    }
+    return __atomic_load_n(&logCalls[call], __ATOMIC_ACQUIRE);
 }
 
+/*
+ * Prints the entries in the ring, oldest first
+ */
 INSTRUCTION_DEF printLogs(VFrame* cframe) {
-    LOG_LI* probe = logListHead;
-    if (probe == NULL) {
-        return RETURN_OK;
+    uint64_t next = __atomic_load_n(&logNext, __ATOMIC_ACQUIRE);
+    for (uint64_t seq = oldestLogEntry(next); seq < next; seq++) {
+        LOG_ENTRY entry;
+        if (readLogEntry(seq, &entry)) {
+            printf("%s | %d | %p\n", logCallName(entry.call), entry.errorCode, (void*) entry.handle);
+        }
     }
-    for (probe; probe->next != NULL; probe = probe->next) {
-        printf("%s | %d\n", probe->APIFunctionCall, probe->errorCode);
+    return RETURN_OK;
+}
+
+/*
+ * Returns the entries in the ring, oldest first, as LOG_FIELDS values
+ * each: {sequence number, timestamp (ns, see getTimestamp), error code,
+ * handle, index of the call in getLogCalls}. Entries mid-write are
+ * left out
+ */
+INSTRUCTION_DEF getLogEntries(FrameData* cframe) {
+    uint64_t next = __atomic_load_n(&logNext, __ATOMIC_ACQUIRE);
+    uint64_t oldest = oldestLogEntry(next);
+    LOG_ENTRY copies[LOG_RING_SIZE];
+    uint64_t seqs[LOG_RING_SIZE];
+    size_t count = 0;
+    for (uint64_t seq = oldest; seq < next; seq++) {
+        if (readLogEntry(seq, &copies[count])) {
+            seqs[count] = seq;
+            count++;
+        }
+    }
+
+    DanaEl* returnArray = api->makeArray(intArrayGT, count*LOG_FIELDS, NULL);
+    for (size_t i = 0; i < count; i++) {
+        api->setArrayCellInt(returnArray, i*LOG_FIELDS, (size_t) seqs[i]);
+        api->setArrayCellInt(returnArray, i*LOG_FIELDS + 1, (size_t) copies[i].timestamp);
+        api->setArrayCellInt(returnArray, i*LOG_FIELDS + 2, (size_t) (int64_t) copies[i].errorCode);
+        api->setArrayCellInt(returnArray, i*LOG_FIELDS + 3, copies[i].handle);
+        api->setArrayCellInt(returnArray, i*LOG_FIELDS + 4, copies[i].call);
+    }
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+/*
+ * Returns the names of the calls entries refer to, by index. Names
+ * are only ever appended, so this covers every entry returned by an
+ * earlier getLogEntries
+ */
+INSTRUCTION_DEF getLogCalls(FrameData* cframe) {
+    size_t count = 0;
+    while (count < LOG_MAX_CALLS && __atomic_load_n(&logCalls[count], __ATOMIC_ACQUIRE) != NULL) {
+        count++;
+    }
+    DanaEl* returnArray = api->makeArray(stringArrayGT, count, NULL);
+    for (size_t i = 0; i < count; i++) {
+        const char* name = logCallName(i);
+        DanaEl* string = api->makeData(stringItemGT);
+        size_t len = strlen(name);
+        unsigned char* cnt = NULL;
+        DanaEl* charArr = api->makeArray(charArrayGT, len, &cnt);
+        memcpy(cnt, name, len);
+        api->setDataFieldEl(string, 0, charArr);
+        api->setArrayCellEl(returnArray, i, string);
+    }
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+/*
+ * Returns {entries logged, entries overwritten, entries whose call or
+ * code didn't fit the tables} followed by {error code, count} for
+ * every code logged
+ */
+INSTRUCTION_DEF getLogCounts(FrameData* cframe) {
+    uint64_t next = __atomic_load_n(&logNext, __ATOMIC_ACQUIRE);
+    size_t codes = 0;
+    while (codes < LOG_MAX_CODES && __atomic_load_n(&logCodes[codes], __ATOMIC_ACQUIRE) != LOG_NO_CODE) {
+        codes++;
+    }
+    DanaEl* returnArray = api->makeArray(intArrayGT, 3 + codes*2, NULL);
+    api->setArrayCellInt(returnArray, 0, (size_t) next);
+    api->setArrayCellInt(returnArray, 1, (size_t) oldestLogEntry(next));
+    api->setArrayCellInt(returnArray, 2, (size_t) __atomic_load_n(&logUntracked, __ATOMIC_RELAXED));
+    for (size_t i = 0; i < codes; i++) {
+        api->setArrayCellInt(returnArray, 3 + i*2, (size_t) (int64_t) __atomic_load_n(&logCodes[i], __ATOMIC_ACQUIRE));
+        api->setArrayCellInt(returnArray, 4 + i*2, (size_t) __atomic_load_n(&logCodeCounts[i], __ATOMIC_RELAXED));
     }
-    printf("%s | %d\n", probe->APIFunctionCall, probe->errorCode);
+    api->returnEl(cframe, returnArray);
     return RETURN_OK;
 }
 
 INSTRUCTION_DEF createContextSpace(VFrame* cframe) {
     DANA_COMP* dana_component_id = (DANA_COMP*) malloc(sizeof(DANA_COMP));
     dana_component_id->contexts = NULL;
+    pthread_mutex_init(&dana_component_id->poolLock, NULL);
+    dana_component_id->pool = NULL;
+    dana_component_id->poolLimit = POOL_DEFAULT_LIMIT;
+    dana_component_id->poolHits = 0;
+    dana_component_id->poolMisses = 0;
+    dana_component_id->poolBytesRetained = 0;
+    dana_component_id->poolObjectsRetained = 0;
     api->returnInt(cframe, (size_t) dana_component_id);
     return RETURN_OK;
 }
@@ -228,6 +778,7 @@ INSTRUCTION_DEF init(VFrame* cframe) {
     cl_int CL_err = CL_SUCCESS;
 
     if (alreadyInitFlag) {
+        api->returnInt(cframe, (size_t) noPlatforms);
         return RETURN_OK;
     }
 
@@ -235,7 +786,11 @@ INSTRUCTION_DEF init(VFrame* cframe) {
     
     CL_err = clGetPlatformIDs( MAX_PLATFORMS, globalClPlatforms, &numofPlatforms );
     if (CL_err != CL_SUCCESS) {
+        //the host device is still available
         printf("no opencl implimentation found\n");
+        numofPlatforms = 0;
+        noPlatforms = 1;
+        alreadyInitFlag = 1;
         api->returnInt(cframe, (size_t) 1);
         return RETURN_OK;
     }
@@ -260,9 +815,267 @@ INSTRUCTION_DEF init(VFrame* cframe) {
     return RETURN_OK;
 }
 
+/*
+ * The host device. Nodes without an OpenCL platform, or callers that
+ * name it, can run the shipped kernels on the host's own cores. It is
+ * listed after the OpenCL devices as HOST_DEVICE_NAME, and its device,
+ * queue, memory and program handles are host structures rather than
+ * OpenCL objects, so every function taking one checks for it before
+ * calling OpenCL. Its memory is plain host memory (matrices are always
+ * buffer matrices, as it reports no image support), transfers marshal
+ * straight into it, and kernels are C implementations looked up by
+ * function name, see runHostKernel. Commands have completed by the
+ * time the call issuing them returns, so their events always have
+ */
+#define HOST_DEVICE_NAME "Dana host"
+//rows of a host buffer matrix start on a new cache line
+#define HOST_ROW_ALIGN 64
+#define HOST_MAX_THREADS 64
+//reported as the host device's limits, for callers sizing work-groups and tiles
+#define HOST_MAX_GROUP 1024
+#define HOST_LOCAL_MEM 32768
+
+//threads host kernels run on, one per core (set by probeLayouts)
+size_t hostThreads = 1;
+
+//each host queue is a distinct slot, so kernels cached per queue aren't shared between Compute instances
+#define HOST_QUEUE_SLOTS 256
+
+static char hostDeviceTag;
+static char hostQueueTags[HOST_QUEUE_SLOTS];
+#define HOST_DEVICE ((cl_device_id) &hostDeviceTag)
+
+typedef struct _host_mem {
+    size_t type;
+    size_t elementSize;
+    //bytes between the starts of consecutive rows, the whole length for an array
+    size_t rowPitch;
+    size_t rows;
+    unsigned char* data;
+    //0 for a view of another host matrix's rows, whose data isn't its to free
+    uint8_t ownsData;
+    struct _host_mem* next;
+} HOST_MEM;
+
+typedef struct _host_program {
+    char* source;
+    struct _host_program* next;
+} HOST_PROGRAM;
+
+HOST_MEM* hostMems = NULL;
+HOST_PROGRAM* hostPrograms = NULL;
+uint8_t hostQueueUsed[HOST_QUEUE_SLOTS];
+pthread_mutex_t hostHandleLock = PTHREAD_MUTEX_INITIALIZER;
+
+uint8_t isHostDevice(cl_device_id device) {
+    return device == HOST_DEVICE;
+}
+
+uint8_t isHostQueue(cl_command_queue queue) {
+    return (char*) queue >= hostQueueTags && (char*) queue < hostQueueTags + HOST_QUEUE_SLOTS;
+}
+
+//returns NULL once every slot is taken
+cl_command_queue newHostQueue() {
+    cl_command_queue queue = NULL;
+    pthread_mutex_lock(&hostHandleLock);
+    for (size_t i = 0; i < HOST_QUEUE_SLOTS && queue == NULL; i++) {
+        if (!hostQueueUsed[i]) {
+            hostQueueUsed[i] = 1;
+            queue = (cl_command_queue) &hostQueueTags[i];
+        }
+    }
+    pthread_mutex_unlock(&hostHandleLock);
+    return queue;
+}
+
+void freeHostQueue(cl_command_queue queue) {
+    pthread_mutex_lock(&hostHandleLock);
+    hostQueueUsed[(char*) queue - hostQueueTags] = 0;
+    pthread_mutex_unlock(&hostHandleLock);
+}
+
+HOST_MEM* findHostMem(cl_mem memObj) {
+    pthread_mutex_lock(&hostHandleLock);
+    HOST_MEM* probe = hostMems;
+    while (probe != NULL && probe != (HOST_MEM*) memObj) {
+        probe = probe->next;
+    }
+    pthread_mutex_unlock(&hostHandleLock);
+    return probe;
+}
+
+HOST_MEM* newHostMem(size_t type, size_t elementSize, size_t rows, size_t cols, uint8_t isMatrix) {
+    HOST_MEM* mem = (HOST_MEM*) malloc(sizeof(HOST_MEM));
+    mem->type = type;
+    mem->elementSize = elementSize;
+    mem->rows = rows;
+    mem->rowPitch = cols*elementSize;
+    if (isMatrix) {
+        mem->rowPitch = ((mem->rowPitch + HOST_ROW_ALIGN - 1)/HOST_ROW_ALIGN)*HOST_ROW_ALIGN;
+    }
+    size_t bytes = mem->rowPitch*rows;
+    mem->data = (unsigned char*) calloc(bytes > 0 ? bytes : 1, 1);
+    if (mem->data == NULL) {
+        free(mem);
+        return NULL;
+    }
+    mem->ownsData = 1;
+    pthread_mutex_lock(&hostHandleLock);
+    mem->next = hostMems;
+    hostMems = mem;
+    pthread_mutex_unlock(&hostHandleLock);
+    return mem;
+}
+
+//returns 1 if memObj was host memory (and is now freed)
+uint8_t freeHostMem(cl_mem memObj) {
+    pthread_mutex_lock(&hostHandleLock);
+    HOST_MEM* prev = NULL;
+    HOST_MEM* probe = hostMems;
+    while (probe != NULL && probe != (HOST_MEM*) memObj) {
+        prev = probe;
+        probe = probe->next;
+    }
+    if (probe != NULL) {
+        if (prev == NULL) {
+            hostMems = probe->next;
+        }
+        else {
+            prev->next = probe->next;
+        }
+    }
+    pthread_mutex_unlock(&hostHandleLock);
+    if (probe == NULL) {
+        return 0;
+    }
+    if (probe->ownsData) {
+        free(probe->data);
+    }
+    free(probe);
+    return 1;
+}
+
+HOST_PROGRAM* newHostProgram(char* source) {
+    HOST_PROGRAM* prog = (HOST_PROGRAM*) malloc(sizeof(HOST_PROGRAM));
+    prog->source = source;
+    pthread_mutex_lock(&hostHandleLock);
+    prog->next = hostPrograms;
+    hostPrograms = prog;
+    pthread_mutex_unlock(&hostHandleLock);
+    return prog;
+}
+
+//returns 1 if program was a host program (and is now freed)
+uint8_t freeHostProgram(cl_program program) {
+    pthread_mutex_lock(&hostHandleLock);
+    HOST_PROGRAM* prev = NULL;
+    HOST_PROGRAM* probe = hostPrograms;
+    while (probe != NULL && probe != (HOST_PROGRAM*) program) {
+        prev = probe;
+        probe = probe->next;
+    }
+    if (probe != NULL) {
+        if (prev == NULL) {
+            hostPrograms = probe->next;
+        }
+        else {
+            prev->next = probe->next;
+        }
+    }
+    pthread_mutex_unlock(&hostHandleLock);
+    if (probe == NULL) {
+        return 0;
+    }
+    free(probe->source);
+    free(probe);
+    return 1;
+}
+
+//true if source declares the kernel 'name', as clCreateKernel would find it
+uint8_t hostDeclaresKernel(char* source, char* name) {
+    size_t len = strlen(name);
+    for (char* at = strstr(source, "__kernel"); at != NULL; at = strstr(at + 1, "__kernel")) {
+        char* fn = at + strlen("__kernel");
+        while (*fn == ' ' || *fn == '\t' || *fn == '\n') {
+            fn++;
+        }
+        if (strncmp(fn, "void", 4) != 0) {
+            continue;
+        }
+        fn += 4;
+        while (*fn == ' ' || *fn == '\t' || *fn == '\n') {
+            fn++;
+        }
+        if (strncmp(fn, name, len) != 0) {
+            continue;
+        }
+        fn += len;
+        while (*fn == ' ' || *fn == '\t') {
+            fn++;
+        }
+        if (*fn == '(') {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Copies between a host buffer and tightly packed host memory, as
+ * enqueueWrite/enqueueRead do for OpenCL memory objects
+ */
+uint8_t hostRegionFits(HOST_MEM* mem, size_t* lens, size_t lenCount) {
+    size_t rows = lenCount == 2 ? lens[0] : 1;
+    size_t rowBytes = (lenCount == 2 ? lens[1] : lens[0])*mem->elementSize;
+    return rows <= mem->rows && rowBytes <= mem->rowPitch;
+}
+
+cl_int hostCopyIn(HOST_MEM* mem, size_t* lens, size_t lenCount, void* host) {
+    size_t rows = lenCount == 2 ? lens[0] : 1;
+    size_t rowBytes = (lenCount == 2 ? lens[1] : lens[0])*mem->elementSize;
+    if (!hostRegionFits(mem, lens, lenCount)) {
+        return CL_INVALID_VALUE;
+    }
+    for (size_t r = 0; r < rows; r++) {
+        memcpy(mem->data + r*mem->rowPitch, (unsigned char*) host + r*rowBytes, rowBytes);
+    }
+    return CL_SUCCESS;
+}
+
+cl_int hostCopyOut(HOST_MEM* mem, size_t* lens, size_t lenCount, void* host) {
+    size_t rows = lenCount == 2 ? lens[0] : 1;
+    size_t rowBytes = (lenCount == 2 ? lens[1] : lens[0])*mem->elementSize;
+    if (!hostRegionFits(mem, lens, lenCount)) {
+        return CL_INVALID_VALUE;
+    }
+    for (size_t r = 0; r < rows; r++) {
+        memcpy((unsigned char*) host + r*rowBytes, mem->data + r*mem->rowPitch, rowBytes);
+    }
+    return CL_SUCCESS;
+}
+
+//bytes of physical memory, reported as the host device's global memory
+uint64_t hostMemoryBytes() {
+#ifdef WINDOWS
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if (!GlobalMemoryStatusEx(&status)) {
+        return 0;
+    }
+    return (uint64_t) status.ullTotalPhys;
+#else
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long pageSize = sysconf(_SC_PAGE_SIZE);
+    return pages < 0 || pageSize < 0 ? 0 : (uint64_t) pages*(uint64_t) pageSize;
+#endif
+}
+
+
 /* Returns to the caller all the device IDs
  * available to the system from the global state
- * i.e that which was set in init(). This function
+ * i.e that which was set in init(), followed by
+ * the host device. This function
  * DOES NOT return the device IDs which a dana component
  * instance has created a context for.
  */
@@ -270,8 +1083,9 @@ INSTRUCTION_DEF getComputeDeviceIDs(VFrame* cframe) {
     cl_int CL_err = CL_SUCCESS;
 
     if (devices == NULL) {
-        //return empty array
-        DanaEl* newArray = api->makeArray(stringArrayGT, 0, NULL);
+        //only the host device
+        DanaEl* newArray = api->makeArray(intArrayGT, 1, NULL);
+        api->setArrayCellInt(newArray, 0, (size_t) HOST_DEVICE);
         api->returnEl(cframe, newArray);
         //exit
         return RETURN_OK;
@@ -296,11 +1110,12 @@ INSTRUCTION_DEF getComputeDeviceIDs(VFrame* cframe) {
     }
 
     //arrange in a dana array
-    DanaEl* returnArray = api->makeArray(intArrayGT, arrSize, NULL);
+    DanaEl* returnArray = api->makeArray(intArrayGT, arrSize + 1, NULL);
 
     for (int i = 0; i < arrSize; i++) {
         api->setArrayCellInt(returnArray, i, (size_t) ids[i]);
     }
+    api->setArrayCellInt(returnArray, arrSize, (size_t) HOST_DEVICE);
 
     //return
     api->returnEl(cframe, returnArray);
@@ -313,28 +1128,23 @@ INSTRUCTION_DEF getComputeDeviceIDs(VFrame* cframe) {
  * to the system. This is taken from the global state, i.e
  * all devices on the system, not just the devices the 
  * dana component instance has access to through a context.
+ * The host device is last, in the same order as
+ * getComputeDeviceIDs
  */
 INSTRUCTION_DEF getComputeDevices(VFrame* cframe) {
     cl_int CL_err = CL_SUCCESS;
-    if (devices == NULL) {
-        //return empty array
-        DanaEl* newArray = api->makeArray(stringArrayGT, 0, NULL);
-        api->returnEl(cframe, newArray);
-        //exit
-        return RETURN_OK;
-    }
 
     //go thru each platform
     int arrSize = 0;
-    for (int i = 0; i < numofPlatforms; i++) {
+    for (int i = 0; devices != NULL && i < numofPlatforms; i++) {
         arrSize += *(numOfDevicesPerPlatform+i);
     }
 
     //grab each device ID and query opencl for the device name
-    char* deviceNames[arrSize];
+    char* deviceNames[arrSize + 1];
     int seen = 0;
     //for each platform
-    for (int i = 0; i < numofPlatforms; i++) {
+    for (int i = 0; devices != NULL && i < numofPlatforms; i++) {
         //for each device in that platform
         for (int j = 0; j < *(numOfDevicesPerPlatform+i); j++) {
             char* buf = (char*) malloc(sizeof(char)*500);
@@ -346,6 +1156,9 @@ INSTRUCTION_DEF getComputeDevices(VFrame* cframe) {
         seen += *(numOfDevicesPerPlatform+i);
     }
 
+    deviceNames[arrSize] = strdup(HOST_DEVICE_NAME);
+    arrSize++;
+
     //arrange device names in a dana array
     DanaEl* returnArray = api->makeArray(stringArrayGT, arrSize, NULL);
 
@@ -372,6 +1185,48 @@ INSTRUCTION_DEF getComputeDevices(VFrame* cframe) {
     return RETURN_OK;
 }
 
+INSTRUCTION_DEF getHostDeviceName(FrameData* cframe) {
+    size_t len = strlen(HOST_DEVICE_NAME);
+    unsigned char* cnt = NULL;
+    DanaEl* name = api->makeArray(charArrayGT, len, &cnt);
+    memcpy(cnt, HOST_DEVICE_NAME, len);
+    api->returnEl(cframe, name);
+    return RETURN_OK;
+}
+
+/*
+ * Names of the devices ComputeInfo reports, one per line, so that a
+ * LogicalCompute (which spreads over every device it's told of) can
+ * be kept to some of them. NULL means every device. Set from the
+ * DANA_OPENCL_DEVICES environment variable, names separated by ';',
+ * or setVisibleDevices. Filtering is done on the dana side
+ */
+#define VISIBLE_DEVICES_ENV "DANA_OPENCL_DEVICES"
+
+char* visibleDevices = NULL;
+
+INSTRUCTION_DEF setVisibleDevices(FrameData* cframe) {
+    char* names = x_getParam_char_array(api, cframe, 0);
+    free(visibleDevices);
+    visibleDevices = NULL;
+    if (strlen(names) == 0) {
+        free(names);
+        return RETURN_OK;
+    }
+    visibleDevices = names;
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF getVisibleDevices(FrameData* cframe) {
+    char* names = visibleDevices == NULL ? "" : visibleDevices;
+    size_t len = strlen(names);
+    unsigned char* cnt = NULL;
+    DanaEl* charArr = api->makeArray(charArrayGT, len, &cnt);
+    memcpy(cnt, names, len);
+    api->returnEl(cframe, charArr);
+    return RETURN_OK;
+}
+
 /* A context in opencl is a set of physical devices, command queues pointing to
  * those devices (Many Qs to 1 Device), kernels and memory objects
  * All devices in a context must belong to the same platform
@@ -433,7 +1288,7 @@ INSTRUCTION_DEF createContext(FrameData* cframe) {
             const cl_context_properties props[] = {CL_CONTEXT_PLATFORM, newContextItem->platform, 0};
             newContextItem->context = clCreateContext(props, newContextItem->numOfDevices, newContextItem->devices, NULL, NULL, &CL_Err);
             if (CL_Err != CL_SUCCESS) {
-                addLog(newLogItem("clCreateContext", CL_Err));
+                addLog("clCreateContext", CL_Err, danaComp);
                 api->returnInt(cframe, (size_t) 1);
                 return RETURN_OK;
             }
@@ -445,41 +1300,274 @@ INSTRUCTION_DEF createContext(FrameData* cframe) {
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF createAsynchQueue(FrameData* cframe) {
-    cl_int CL_err = CL_SUCCESS;
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_device_id device = (cl_device_id) rawParam; 
+/*
+ * Profiling. With it on, queues are created with
+ * CL_QUEUE_PROFILING_ENABLE, and each transfer and kernel launch is
+ * recorded under its operation (the kernel's function name, "write"
+ * or "read") once it has completed: the time between it being queued
+ * and submitted to the device, the time it then waited to start, the
+ * time it ran, the host time spent marshalling its data and the bytes
+ * it moved, with a histogram of run times. Commands on queues created
+ * before profiling was turned on, and transfers that map rather than
+ * copy, have no device times, so only their host side is recorded.
+ * Recording is a few clGetEventProfilingInfo calls per command, and
+ * nothing at all with profiling off
+ */
+#define PROFILE_ENV "DANA_OPENCL_PROFILE"
+#define PROFILE_BUCKETS 32
+#define PROFILE_FIELDS 10
+
+typedef struct _profile_list_item {
+    char* name;
+    size_t count;
+    size_t timed;
+    uint64_t submitNs;
+    uint64_t waitNs;
+    uint64_t deviceNs;
+    uint64_t hostNs;
+    uint64_t bytes;
+    uint64_t timedBytes;
+    uint64_t minNs;
+    uint64_t maxNs;
+    size_t histogram[PROFILE_BUCKETS];
+    struct _profile_list_item* next;
+} PROFILE_LI;
+
+PROFILE_LI* profiles = NULL;
+PROFILE_LI* lastProfile = NULL;
+uint8_t profilingOn = 0;
+//guards the profile list, commands from many threads are recorded into it
+pthread_mutex_t profileLock = PTHREAD_MUTEX_INITIALIZER;
+
+PROFILE_LI* findProfile(const char* name, uint8_t create) {
+    for (PROFILE_LI* probe = profiles; probe != NULL; probe = probe->next) {
+        if (strcmp(probe->name, name) == 0) {
+            return probe;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    PROFILE_LI* entry = (PROFILE_LI*) calloc(1, sizeof(PROFILE_LI));
+    entry->name = strdup(name);
+    //kept in the order operations were first seen
+    if (lastProfile == NULL) {
+        profiles = entry;
+    }
+    else {
+        lastProfile->next = entry;
+    }
+    lastProfile = entry;
+    return entry;
+}
 
-    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 1);
-    CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
-    cl_context context = contextItem->context;
+void clearProfiles() {
+    while (profiles != NULL) {
+        PROFILE_LI* next = profiles->next;
+        free(profiles->name);
+        free(profiles);
+        profiles = next;
+    }
+    lastProfile = NULL;
+}
 
-    const cl_queue_properties props = {CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+//bucket i counts run times in [2^i, 2^(i+1)) ns, the last one everything longer
+size_t profileBucket(uint64_t ns) {
+    size_t bucket = 0;
+    while (ns > 1 && bucket < PROFILE_BUCKETS - 1) {
+        ns >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
 
-    cl_command_queue newQ = clCreateCommandQueue(context, device, props, &CL_err);
-    if(CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateCommandQueueWithProperties", CL_err));
-        api->returnInt(cframe, (size_t) 0);
+void recordRun(PROFILE_LI* entry, uint64_t bytes, uint64_t ran) {
+    entry->deviceNs += ran;
+    entry->timedBytes += bytes;
+    if (entry->timed == 0 || ran < entry->minNs) {
+        entry->minNs = ran;
+    }
+    if (ran > entry->maxNs) {
+        entry->maxNs = ran;
+    }
+    entry->histogram[profileBucket(ran)]++;
+    entry->timed++;
+}
+
+/*
+ * Records a completed command. event may be NULL for a command that
+ * only has host side costs
+ */
+void recordProfile(const char* name, cl_event event, uint64_t bytes, uint64_t hostNs) {
+    if (!profilingOn) {
+        return;
+    }
+    cl_ulong queued = 0;
+    cl_ulong submitted = 0;
+    cl_ulong started = 0;
+    cl_ulong ended = 0;
+    uint8_t timed = event != NULL
+        && clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_QUEUED, sizeof(cl_ulong), &queued, NULL) == CL_SUCCESS
+        && clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_SUBMIT, sizeof(cl_ulong), &submitted, NULL) == CL_SUCCESS
+        && clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &started, NULL) == CL_SUCCESS
+        && clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &ended, NULL) == CL_SUCCESS;
+
+    pthread_mutex_lock(&profileLock);
+    PROFILE_LI* entry = findProfile(name, 1);
+    entry->count++;
+    entry->bytes += bytes;
+    entry->hostNs += hostNs;
+    if (timed) {
+        entry->submitNs += submitted - queued;
+        entry->waitNs += started - submitted;
+        recordRun(entry, bytes, ended - started);
+    }
+    pthread_mutex_unlock(&profileLock);
+}
+
+/*
+ * Records a kernel run on the host device, where the run time is
+ * measured around the call and it neither queued nor waited
+ */
+void recordHostProfile(const char* name, uint64_t bytes, uint64_t ran) {
+    if (!profilingOn) {
+        return;
+    }
+    pthread_mutex_lock(&profileLock);
+    PROFILE_LI* entry = findProfile(name, 1);
+    entry->count++;
+    entry->bytes += bytes;
+    recordRun(entry, bytes, ran);
+    pthread_mutex_unlock(&profileLock);
+}
+
+void recordKernelProfile(cl_kernel kernel, cl_event event) {
+    if (!profilingOn) {
+        return;
+    }
+    char name[256];
+    name[0] = '\0';
+    clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, sizeof(name), name, NULL);
+    recordProfile(name, event, 0, 0);
+}
+
+/*
+ * Turns profiling on or off. Only queues created while it is on
+ * can time commands on the device, so it should be turned on before
+ * the Compute instances to be profiled are created
+ */
+INSTRUCTION_DEF setProfiling(FrameData* cframe) {
+    profilingOn = api->getParamRaw(cframe, 0)[0] != 0;
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF getProfiling(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) profilingOn);
+    return RETURN_OK;
+}
+
+/*
+ * Returns the names of the operations recorded, in the order
+ * they were first seen
+ */
+INSTRUCTION_DEF getProfileNames(FrameData* cframe) {
+    pthread_mutex_lock(&profileLock);
+    size_t count = 0;
+    for (PROFILE_LI* probe = profiles; probe != NULL; probe = probe->next) {
+        count++;
+    }
+    DanaEl* returnArray = api->makeArray(stringArrayGT, count, NULL);
+    size_t i = 0;
+    for (PROFILE_LI* probe = profiles; probe != NULL; probe = probe->next) {
+        DanaEl* string = api->makeData(stringItemGT);
+        size_t sublen = strlen(probe->name);
+        unsigned char* cnt = NULL;
+        DanaEl* charArr = api->makeArray(charArrayGT, sublen, &cnt);
+        memcpy(cnt, probe->name, sublen);
+        api->setDataFieldEl(string, 0, charArr);
+        api->setArrayCellEl(returnArray, i, string);
+        i++;
+    }
+    pthread_mutex_unlock(&profileLock);
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+/*
+ * Returns [count, count with device times, submit ns, wait ns,
+ * device ns, host ns, bytes, min device ns, max device ns, bytes
+ * moved by the runs with device times] followed
+ * by the histogram of device times for an operation, or null if it
+ * hasn't been recorded
+ */
+INSTRUCTION_DEF getProfile(FrameData* cframe) {
+    char* name = x_getParam_char_array(api, cframe, 0);
+    pthread_mutex_lock(&profileLock);
+    PROFILE_LI* entry = findProfile(name, 0);
+    free(name);
+    if (entry == NULL) {
+        pthread_mutex_unlock(&profileLock);
+        api->returnEl(cframe, NULL);
         return RETURN_OK;
     }
+    DanaEl* returnArray = api->makeArray(intArrayGT, PROFILE_FIELDS + PROFILE_BUCKETS, NULL);
+    api->setArrayCellInt(returnArray, 0, entry->count);
+    api->setArrayCellInt(returnArray, 1, entry->timed);
+    api->setArrayCellInt(returnArray, 2, entry->submitNs);
+    api->setArrayCellInt(returnArray, 3, entry->waitNs);
+    api->setArrayCellInt(returnArray, 4, entry->deviceNs);
+    api->setArrayCellInt(returnArray, 5, entry->hostNs);
+    api->setArrayCellInt(returnArray, 6, entry->bytes);
+    api->setArrayCellInt(returnArray, 7, entry->minNs);
+    api->setArrayCellInt(returnArray, 8, entry->maxNs);
+    api->setArrayCellInt(returnArray, 9, entry->timedBytes);
+    for (size_t i = 0; i < PROFILE_BUCKETS; i++) {
+        api->setArrayCellInt(returnArray, PROFILE_FIELDS + i, entry->histogram[i]);
+    }
+    pthread_mutex_unlock(&profileLock);
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
 
-    api->returnInt(cframe, (size_t) newQ);
+INSTRUCTION_DEF resetProfile(FrameData* cframe) {
+    pthread_mutex_lock(&profileLock);
+    clearProfiles();
+    pthread_mutex_unlock(&profileLock);
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF createSynchQueue(FrameData* cframe) {
+INSTRUCTION_DEF createAsynchQueue(FrameData* cframe) {
     cl_int CL_err = CL_SUCCESS;
     size_t rawParam = api->getParamInt(cframe, 0);
-
     cl_device_id device = (cl_device_id) rawParam; 
 
+    if (isHostDevice(device)) {
+        cl_command_queue hostQ = newHostQueue();
+        if (hostQ == NULL) {
+            addLog("newHostQueue", CL_OUT_OF_RESOURCES, device);
+        }
+        api->returnInt(cframe, (size_t) hostQ);
+        return RETURN_OK;
+    }
+
     DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 1);
     CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
     cl_context context = contextItem->context;
 
-    cl_command_queue newQ = clCreateCommandQueue(context, device, NULL, &CL_err);
+    cl_command_queue_properties props = CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+    if (profilingOn) {
+        props |= CL_QUEUE_PROFILING_ENABLE;
+    }
+
+    cl_command_queue newQ = clCreateCommandQueue(context, device, props, &CL_err);
+    //a device without out-of-order queues still gets a queue of its own for
+    //the async commands, so they overlap the blocking ones if not each other
+    if (CL_err == CL_INVALID_QUEUE_PROPERTIES || CL_err == CL_INVALID_VALUE) {
+        props &= ~CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+        newQ = clCreateCommandQueue(context, device, props, &CL_err);
+    }
     if(CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateCommandQueueWithProperties", CL_err));
+        addLog("clCreateCommandQueueWithProperties", CL_err, device);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
@@ -488,390 +1576,4363 @@ INSTRUCTION_DEF createSynchQueue(FrameData* cframe) {
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF createArray(FrameData* cframe) {
+INSTRUCTION_DEF createSynchQueue(FrameData* cframe) {
     cl_int CL_err = CL_SUCCESS;
     size_t rawParam = api->getParamInt(cframe, 0);
-    cl_device_id device = (cl_device_id) rawParam;
-
-    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 3);
-    CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
-    cl_context context = contextItem->context;
 
-    rawParam = api->getParamInt(cframe, 1);
-    size_t length = (size_t) rawParam;
-
-    rawParam = api->getParamInt(cframe, 2);
-    size_t type = (size_t) rawParam;
+    cl_device_id device = (cl_device_id) rawParam; 
 
-    size_t size;
-    if (type == FLOAT) {
-        size = sizeof(float)*length;
-    }
-    else if (type == UINT) {
-        size = sizeof(size_t)*length;
-    }
-    else {
-        api->returnInt(cframe, (size_t) 0);
+    if (isHostDevice(device)) {
+        cl_command_queue hostQ = newHostQueue();
+        if (hostQ == NULL) {
+            addLog("newHostQueue", CL_OUT_OF_RESOURCES, device);
+        }
+        api->returnInt(cframe, (size_t) hostQ);
         return RETURN_OK;
     }
 
-    cl_mem newArray = clCreateBuffer(context, CL_MEM_READ_WRITE, size, NULL, &CL_err);
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 1);
+    CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
+    cl_context context = contextItem->context;
 
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateBuffer", CL_err));
+    cl_command_queue_properties props = profilingOn ? CL_QUEUE_PROFILING_ENABLE : 0;
+    cl_command_queue newQ = clCreateCommandQueue(context, device, props, &CL_err);
+    if(CL_err != CL_SUCCESS) {
+        addLog("clCreateCommandQueueWithProperties", CL_err, device);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
 
-    api->returnInt(cframe, (size_t) newArray);
-
+    api->returnInt(cframe, (size_t) newQ);
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF writeIntArray(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
-
-    DanaEl* hostArray = api->getParamEl(cframe, 2);
-    size_t hostArrayLen = api->getArrayLength(hostArray);
-
-    size_t* rawHostArray = (size_t*) malloc(sizeof(size_t)*hostArrayLen);
-    size_t* rawHostArrayCpy = rawHostArray;
-    for (int i = 0; i < hostArrayLen; i++) {
-        *rawHostArrayCpy = api->getArrayCellInt(hostArray, i);
-        rawHostArrayCpy++;
-    }
-
-    cl_int CL_err = clEnqueueWriteBuffer(queue, memObj, CL_TRUE, 0, hostArrayLen*sizeof(size_t), rawHostArray, NULL, NULL, NULL);
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueWriteBuffer", CL_err));
-        api->returnInt(cframe, (size_t) 1);
-        return RETURN_OK;
+/*
+ * MEM_MAPPED memory objects are allocated by opencl in host
+ * accessible memory (CL_MEM_ALLOC_HOST_PTR) and transferred by
+ * mapping rather than copying, see transferIn/transferOut
+ */
+cl_mem_flags allocFlags(size_t mode) {
+    if (mode == MEM_MAPPED) {
+        return CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR;
     }
-    api->returnInt(cframe, (size_t) 0);
-    free(rawHostArray);
-    return RETURN_OK;    
+    return CL_MEM_READ_WRITE;
 }
 
-INSTRUCTION_DEF readIntArray(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
-
-    size_t hostArrayLen = api->getParamInt(cframe, 2);
-
-    size_t* rawHostArray = (size_t*) malloc(sizeof(size_t)*hostArrayLen);
-    size_t* toFree = rawHostArray;
-
-    cl_int CL_err = clEnqueueReadBuffer(queue, memObj, CL_TRUE, 0, hostArrayLen*sizeof(size_t), rawHostArray, NULL, NULL, NULL);
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueReadBuffer", CL_err));
-        api->returnEl(cframe, NULL);
+/*
+ * Mapped allocation is the default for devices that share memory
+ * with the host (CPU devices such as pocl, integrated GPUs), where
+ * mapping avoids a copy. Discrete devices default to device memory
+ */
+INSTRUCTION_DEF getDefaultAllocMode(FrameData* cframe) {
+    cl_device_id device = (cl_device_id) api->getParamInt(cframe, 0);
+    //host memory is already where the host is
+    if (isHostDevice(device)) {
+        api->returnInt(cframe, (size_t) MEM_DEVICE);
         return RETURN_OK;
     }
-
-    DanaEl* hostArray = api->makeArray(intArrayGT, hostArrayLen, NULL);
-    for (int i = 0; i < hostArrayLen; i++) {
-        api->setArrayCellInt(hostArray, i, *rawHostArray);
-        rawHostArray++;
+    cl_bool unified = CL_FALSE;
+    cl_device_type type = 0;
+    clGetDeviceInfo(device, CL_DEVICE_HOST_UNIFIED_MEMORY, sizeof(cl_bool), &unified, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_TYPE, sizeof(cl_device_type), &type, NULL);
+    if (unified == CL_TRUE || (type & CL_DEVICE_TYPE_CPU)) {
+        api->returnInt(cframe, (size_t) MEM_MAPPED);
     }
-
-    api->returnEl(cframe, hostArray);
-    (toFree);
-
-    return RETURN_OK;    
+    else {
+        api->returnInt(cframe, (size_t) MEM_DEVICE);
+    }
+    return RETURN_OK;
 }
 
-INSTRUCTION_DEF writeFloatArray(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
-
-    DanaEl* hostArray = api->getParamEl(cframe, 2);
-    size_t hostArrayLen = api->getArrayLength(hostArray);
-
-    float* rawHostArray = (float*) malloc(sizeof(float)*hostArrayLen);
-    float* rawHostArrayCpy = rawHostArray;
-    for (int i = 0; i < hostArrayLen; i++) {
-        *rawHostArrayCpy = api->getArrayCellDec(hostArray, i);
-        rawHostArrayCpy++;
+/*
+ * True if the device reports cl_khr_fp64, which DOUBLE buffers and
+ * the double builds of kernels need
+ */
+uint8_t hasDouble(cl_device_id device) {
+    if (isHostDevice(device)) {
+        return 1;
     }
+    cl_device_fp_config config = 0;
+    clGetDeviceInfo(device, CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(cl_device_fp_config), &config, NULL);
+    return config != 0;
+}
 
-    cl_int CL_err = clEnqueueWriteBuffer(queue, memObj, CL_TRUE, 0, hostArrayLen*sizeof(float), rawHostArray, NULL, NULL, NULL);
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueWriteBuffer", CL_err));
-        api->returnInt(cframe, (size_t) 1);
-        return RETURN_OK;
+/*
+ * True if the device reports cl_khr_fp16, which the half builds of
+ * kernels need. HALF buffers themselves are only storage and can be
+ * created on any device
+ */
+uint8_t hasHalf(cl_device_id device) {
+    size_t len = 0;
+    if (isHostDevice(device)) {
+        return 1;
     }
-    api->returnInt(cframe, (size_t) 0);
-    free(rawHostArray);
-    return RETURN_OK;    
+    if (clGetDeviceInfo(device, CL_DEVICE_EXTENSIONS, 0, NULL, &len) != CL_SUCCESS || len == 0) {
+        return 0;
+    }
+    char* extensions = (char*) malloc(len);
+    clGetDeviceInfo(device, CL_DEVICE_EXTENSIONS, len, extensions, NULL);
+    uint8_t found = strstr(extensions, "cl_khr_fp16") != NULL;
+    free(extensions);
+    return found;
 }
 
-INSTRUCTION_DEF readFloatArray(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
-
-    size_t hostArrayLen = api->getParamInt(cframe, 2);
-
-    float* fromDevice = (float*) malloc(sizeof(float)*hostArrayLen);
-    float* toFree = fromDevice;
-
-    cl_int CL_err = clEnqueueReadBuffer(queue, memObj, CL_TRUE, 0, hostArrayLen*sizeof(float), fromDevice, NULL, NULL, NULL);
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueReadBuffer", CL_err));
-        api->returnEl(cframe, NULL);
+/*
+ * Returns {isCPU, isGPU, max work-group size, local memory bytes,
+ * compute units, global memory bytes, max image width, max image
+ * height, has fp64, has fp16}, for callers picking launch
+ * configurations, placing buffers and choosing matrix layouts and
+ * precisions. Local memory that is emulated in global
+ * memory is reported as 0, as are the image sizes of a device without
+ * image support. The host device is a CPU with a compute unit per
+ * host thread, no images and double and half support
+ */
+INSTRUCTION_DEF getDeviceLimits(FrameData* cframe) {
+    cl_device_id device = (cl_device_id) api->getParamInt(cframe, 0);
+    if (isHostDevice(device)) {
+        size_t hostLimits[10] = {1, 0, HOST_MAX_GROUP, HOST_LOCAL_MEM, hostThreads, (size_t) hostMemoryBytes(), 0, 0, 1, 1};
+        DanaEl* limits = api->makeArray(intArrayGT, 10, NULL);
+        for (int i = 0; i < 10; i++) {
+            api->setArrayCellInt(limits, i, hostLimits[i]);
+        }
+        api->returnEl(cframe, limits);
         return RETURN_OK;
     }
+    cl_device_type type = 0;
+    size_t maxGroup = 1;
+    cl_ulong localMem = 0;
+    cl_device_local_mem_type localType = CL_GLOBAL;
+    cl_uint units = 1;
+    cl_ulong globalMem = 0;
+    cl_bool images = CL_FALSE;
+    size_t imageWidth = 0;
+    size_t imageHeight = 0;
+    clGetDeviceInfo(device, CL_DEVICE_TYPE, sizeof(cl_device_type), &type, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size_t), &maxGroup, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(cl_ulong), &localMem, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_LOCAL_MEM_TYPE, sizeof(cl_device_local_mem_type), &localType, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &units, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(cl_ulong), &globalMem, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_IMAGE_SUPPORT, sizeof(cl_bool), &images, NULL);
+    if (images == CL_TRUE) {
+        clGetDeviceInfo(device, CL_DEVICE_IMAGE2D_MAX_WIDTH, sizeof(size_t), &imageWidth, NULL);
+        clGetDeviceInfo(device, CL_DEVICE_IMAGE2D_MAX_HEIGHT, sizeof(size_t), &imageHeight, NULL);
+    }
+
+    //CPU devices keep "local" memory in cache, so it is as good as dedicated
+    if (localType != CL_LOCAL && !(type & CL_DEVICE_TYPE_CPU)) {
+        localMem = 0;
+    }
 
+    DanaEl* limits = api->makeArray(intArrayGT, 10, NULL);
+    api->setArrayCellInt(limits, 0, (type & CL_DEVICE_TYPE_CPU) ? 1 : 0);
+    api->setArrayCellInt(limits, 1, (type & CL_DEVICE_TYPE_GPU) ? 1 : 0);
+    api->setArrayCellInt(limits, 2, maxGroup);
+    api->setArrayCellInt(limits, 3, (size_t) localMem);
+    api->setArrayCellInt(limits, 4, units);
+    api->setArrayCellInt(limits, 5, (size_t) globalMem);
+    api->setArrayCellInt(limits, 6, imageWidth);
+    api->setArrayCellInt(limits, 7, imageHeight);
+    api->setArrayCellInt(limits, 8, hasDouble(device));
+    api->setArrayCellInt(limits, 9, hasHalf(device));
+    api->returnEl(cframe, limits);
+    return RETURN_OK;
+}
 
-    DanaEl* danaArr = api->makeArray(decArrayGT, hostArrayLen, NULL);
-    for (int i = 0; i < hostArrayLen; i++) {
-        api->setArrayCellDec(danaArr, i, *fromDevice);
-        fromDevice++;
+/*
+ * Bytes per element on the device, lenCount is 1 for an array and
+ * 2 for a matrix
+ */
+size_t elementSize(size_t type, size_t lenCount) {
+    switch (type) {
+        case UINT: return lenCount == 2 ? sizeof(uint32_t) : sizeof(size_t);
+        case DOUBLE: return sizeof(double);
+        case HALF: return sizeof(uint16_t);
+        case INT8: case UINT8: return sizeof(uint8_t);
+        case INT16: case UINT16: return sizeof(uint16_t);
+        case INT32: case UINT32: return sizeof(uint32_t);
+        case INT64: case UINT64: return sizeof(uint64_t);
+        default: return sizeof(float);
     }
+}
 
-    api->returnEl(cframe, danaArr);
-    free(toFree);
+uint8_t isIntType(size_t type) {
+    return type == UINT || (type >= INT8 && type <= UINT64);
+}
 
-    return RETURN_OK;    
+uint8_t knownType(cl_device_id device, size_t type) {
+    return type <= UINT64 && (type != DOUBLE || hasDouble(device));
 }
 
-INSTRUCTION_DEF createMatrix(FrameData* cframe) {
+INSTRUCTION_DEF createArray(FrameData* cframe) {
     cl_int CL_err = CL_SUCCESS;
     size_t rawParam = api->getParamInt(cframe, 0);
     cl_device_id device = (cl_device_id) rawParam;
 
+    if (isHostDevice(device)) {
+        size_t type = api->getParamInt(cframe, 2);
+        HOST_MEM* mem = knownType(device, type) ? newHostMem(type, elementSize(type, 1), 1, api->getParamInt(cframe, 1), 0) : NULL;
+        if (mem == NULL) {
+            addLog("createArray", CL_OUT_OF_HOST_MEMORY, device);
+        }
+        api->returnInt(cframe, (size_t) mem);
+        return RETURN_OK;
+    }
+
     DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 4);
     CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
     cl_context context = contextItem->context;
 
     rawParam = api->getParamInt(cframe, 1);
-    size_t rows = (size_t) rawParam;
+    size_t length = (size_t) rawParam;
 
-    rawParam = api->getParamInt(cframe, 2);
-    size_t cols = (size_t) rawParam;
+    cl_mem_flags flags = allocFlags(api->getParamInt(cframe, 3));
 
-    rawParam = api->getParamInt(cframe, 3);
+    rawParam = api->getParamInt(cframe, 2);
     size_t type = (size_t) rawParam;
 
-    cl_image_desc desc = {CL_MEM_OBJECT_IMAGE2D, cols, rows, 0, 1, 0, 0, 0, 0, NULL};
-    cl_image_format form;
-    if (type == FLOAT) {
-        form = (cl_image_format) {CL_R, CL_FLOAT};
-    }
-    else if (type == UINT) {
-        form = (cl_image_format) {CL_R, CL_UNSIGNED_INT32};
-    }
-    else {
+    if (!knownType(device, type)) {
+        addLog("createArray", CL_INVALID_VALUE, device);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
+    size_t size = elementSize(type, 1)*length;
 
-    cl_mem newMatrix = clCreateImage(context, CL_MEM_READ_WRITE, &form, &desc, NULL, &CL_err);
+    cl_mem newArray = poolAcquireBuffer(danaComp, context, flags, size, &CL_err);
 
     if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateImage", CL_err));
+        addLog("clCreateBuffer", CL_err, device);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
 
-    api->returnInt(cframe, (size_t) newMatrix);
+    api->returnInt(cframe, (size_t) newArray);
 
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF writeIntMatrix(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
+/*
+ * Bulk marshalling. Converting through getArrayCellInt/Dec costs an
+ * indirect call per cell, so where the layout of dana array content
+ * is known the conversion runs directly over getArrayContent instead,
+ * a run of cells at a time, with SIMD where the CPU has it and split
+ * across threads for large arrays.
+ *
+ * The layout isn't part of the native API, so probeLayouts() learns it
+ * at load time by writing known values through the API and checking
+ * which candidate encoding decodes (and encodes) them exactly. If no
+ * candidate matches, every conversion keeps using the per-cell API.
+ * Int cells are a size_t in either byte order. Dec cells are two 64 bit
+ * halves, a signed whole part and a fraction scaled by decFracScale,
+ * in either order and either byte order
+ */
+#define BULK_THREAD_THRESHOLD (1 << 20)
+#define BULK_MAX_THREADS 8
+
+#define PATH_PER_CELL 0
+#define PATH_SCALAR 1
+#define PATH_SSSE3 2
+#define PATH_AVX2 3
+
+uint8_t bulkEnabled = 1;
+uint8_t intLayoutKnown = 0;
+uint8_t intSwapped = 0;
+uint8_t decLayoutKnown = 0;
+uint8_t decSwapped = 0;
+uint8_t decWholeFirst = 1;
+double decFracScale = 0;
+uint8_t simdPath = PATH_SCALAR;
+size_t bulkThreads = 1;
+
+//accumulated by transferIn/transferOut, see getTransferStats. Transfers run
+//on many threads at once, so they're only ever added to atomically
+size_t marshalNs = 0;
+size_t transferNs = 0;
+size_t bytesMarshalled = 0;
+
+uint64_t swap64(uint64_t v, uint8_t swapped) {
+    return swapped ? __builtin_bswap64(v) : v;
+}
 
-    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
-    size_t dim = 2; //only supporting 2d matricies
-    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+uint64_t loadHalf(unsigned char* cell, uint8_t swapped) {
+    uint64_t v;
+    memcpy(&v, cell, sizeof(uint64_t));
+    return swap64(v, swapped);
+}
 
-    uint32_t* rawHostMatrix = (uint32_t*) malloc(sizeof(uint32_t)*dims[0]*dims[1]);
-    uint32_t* rawHostMatrixCpy = rawHostMatrix;
-    for (int i = 0; i < dims[0]; i++) {
-        for (int j = 0; j < dims[1]; j++) {
-            *rawHostMatrixCpy = api->getArrayCellInt(hostMatrix, (i*dims[1])+j);
-            rawHostMatrixCpy++;
-        }
-    }
+void storeHalf(unsigned char* cell, uint64_t v, uint8_t swapped) {
+    v = swap64(v, swapped);
+    memcpy(cell, &v, sizeof(uint64_t));
+}
 
-    size_t origin[] = {0, 0, 0};
-    size_t region[] = {dims[1], dims[0], 1};
-    cl_int CL_err = clEnqueueWriteImage(queue, memObj, CL_TRUE, origin, region, 0, 0, rawHostMatrix, 0, NULL, NULL);
+double decodeDec(unsigned char* cell, uint8_t swapped, uint8_t wholeFirst, double scale) {
+    int64_t whole = (int64_t) loadHalf(wholeFirst ? cell : cell + 8, swapped);
+    uint64_t frac = loadHalf(wholeFirst ? cell + 8 : cell, swapped);
+    return (double) whole + ((double) frac / scale);
+}
 
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueWriteImage", CL_err));
-        api->returnInt(cframe, (size_t) 1);
-        return RETURN_OK;
-    }
-    else {
+void encodeDec(unsigned char* cell, double value, uint8_t swapped, uint8_t wholeFirst, double scale) {
+    double whole = (double) (int64_t) value;
+    if (whole > value) {
+        whole -= 1;
     }
-    api->returnInt(cframe, (size_t) 0);
-    free(rawHostMatrix);
-    return RETURN_OK;    
+    double frac = (value - whole) * scale;
+    uint64_t rawFrac = frac >= scale ? (uint64_t) (scale - 1) : (uint64_t) frac;
+    storeHalf(wholeFirst ? cell : cell + 8, (uint64_t) (int64_t) whole, swapped);
+    storeHalf(wholeFirst ? cell + 8 : cell, rawFrac, swapped);
 }
 
-INSTRUCTION_DEF readIntMatrix(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
+/*
+ * Run kernels: convert n consecutive cells. "swapped" int cells are
+ * byte reversed relative to the host
+ */
+void copyIntCellsScalar(unsigned char* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    if (!swapped) {
+        memcpy(dst, src, n*sizeof(uint64_t));
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        storeHalf(dst + i*8, loadHalf(src + i*8, 1), 0);
+    }
+}
 
-    DanaEl* matrixDims = api->getParamEl(cframe, 2);
-    size_t dim = 2;
-    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+void narrowIntCellsScalar(unsigned char* src, uint32_t* dst, size_t n, uint8_t swapped) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (uint32_t) loadHalf(src + i*8, swapped);
+    }
+}
 
-    uint32_t* rawHostMatrix = (uint32_t*) malloc(sizeof(uint32_t)*hostMatrixLens[0]*hostMatrixLens[1]);
-    uint32_t* toFree = rawHostMatrix;
+void widenIntCellsScalar(uint32_t* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    for (size_t i = 0; i < n; i++) {
+        storeHalf(dst + i*8, (uint64_t) src[i], swapped);
+    }
+}
 
-    size_t origin[] = {0, 0, 0};
-    size_t region[] = {hostMatrixLens[1], hostMatrixLens[0], 1};
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_SIMD
 
+/*
+ * Byte shuffles for 2 cells per 128 bit lane. A -1 entry zeroes the byte
+ */
+__attribute__((target("ssse3")))
+__m128i swapMask64() {
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
 
-    int CL_Err = clEnqueueReadImage(queue, memObj, CL_TRUE, origin, region, 0, 0, rawHostMatrix, 0, NULL, NULL);
-    if (CL_Err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueReadImage", CL_Err));
-        api->returnEl(cframe, NULL);
-        return RETURN_OK;
+__attribute__((target("ssse3")))
+__m128i narrowMask(uint8_t swapped) {
+    if (swapped) {
+        return _mm_setr_epi8(7, 6, 5, 4, 15, 14, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
     }
+    return _mm_setr_epi8(0, 1, 2, 3, 8, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+}
 
-    DanaEl* hostMatrix = api->makeArrayMD(intMatrixGT, 2, hostMatrixLens, NULL);
-    for (int i = 0; i < hostMatrixLens[0]; i++) {
-        for (int j = 0; j < hostMatrixLens[1]; j++) {
-            api->setArrayCellInt(hostMatrix, (i*hostMatrixLens[1])+j, *rawHostMatrix);
-            rawHostMatrix++;
-        }
+__attribute__((target("ssse3")))
+__m128i widenMask(uint8_t swapped) {
+    if (swapped) {
+        return _mm_setr_epi8(-1, -1, -1, -1, 3, 2, 1, 0, -1, -1, -1, -1, 7, 6, 5, 4);
     }
+    return _mm_setr_epi8(0, 1, 2, 3, -1, -1, -1, -1, 4, 5, 6, 7, -1, -1, -1, -1);
+}
 
-    api->returnEl(cframe, hostMatrix);
-    free(toFree);
+__attribute__((target("ssse3")))
+void copyIntCellsSSSE3(unsigned char* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    if (!swapped) {
+        memcpy(dst, src, n*sizeof(uint64_t));
+        return;
+    }
+    __m128i mask = swapMask64();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128((__m128i*) (src + i*8));
+        _mm_storeu_si128((__m128i*) (dst + i*8), _mm_shuffle_epi8(v, mask));
+    }
+    copyIntCellsScalar(src + i*8, dst + i*8, n - i, swapped);
+}
 
-    return RETURN_OK;    
+__attribute__((target("ssse3")))
+void narrowIntCellsSSSE3(unsigned char* src, uint32_t* dst, size_t n, uint8_t swapped) {
+    __m128i mask = narrowMask(swapped);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) (src + i*8)), mask);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*) (src + i*8 + 16)), mask);
+        _mm_storeu_si128((__m128i*) (dst + i), _mm_unpacklo_epi64(a, b));
+    }
+    narrowIntCellsScalar(src + i*8, dst + i, n - i, swapped);
+}
+
+__attribute__((target("ssse3")))
+void widenIntCellsSSSE3(uint32_t* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    __m128i mask = widenMask(swapped);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((__m128i*) (src + i));
+        _mm_storeu_si128((__m128i*) (dst + i*8), _mm_shuffle_epi8(v, mask));
+        _mm_storeu_si128((__m128i*) (dst + i*8 + 16), _mm_shuffle_epi8(_mm_srli_si128(v, 8), mask));
+    }
+    widenIntCellsScalar(src + i, dst + i*8, n - i, swapped);
+}
+
+__attribute__((target("avx2")))
+void copyIntCellsAVX2(unsigned char* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    if (!swapped) {
+        memcpy(dst, src, n*sizeof(uint64_t));
+        return;
+    }
+    __m256i mask = _mm256_broadcastsi128_si256(swapMask64());
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256((__m256i*) (src + i*8));
+        _mm256_storeu_si256((__m256i*) (dst + i*8), _mm256_shuffle_epi8(v, mask));
+    }
+    copyIntCellsScalar(src + i*8, dst + i*8, n - i, swapped);
+}
+
+__attribute__((target("avx2")))
+void narrowIntCellsAVX2(unsigned char* src, uint32_t* dst, size_t n, uint8_t swapped) {
+    __m256i mask = _mm256_broadcastsi128_si256(narrowMask(swapped));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        //each lane packs its 2 cells into its low 64 bits, gather those from both lanes of both loads
+        __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*) (src + i*8)), mask);
+        __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*) (src + i*8 + 32)), mask);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xD8);
+        _mm256_storeu_si256((__m256i*) (dst + i), packed);
+    }
+    narrowIntCellsSSSE3(src + i*8, dst + i, n - i, swapped);
+}
+
+__attribute__((target("avx2")))
+void widenIntCellsAVX2(uint32_t* src, unsigned char* dst, size_t n, uint8_t swapped) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i*) (src + i)));
+        if (swapped) {
+            v = _mm256_shuffle_epi8(v, _mm256_broadcastsi128_si256(swapMask64()));
+        }
+        _mm256_storeu_si256((__m256i*) (dst + i*8), v);
+    }
+    widenIntCellsScalar(src + i, dst + i*8, n - i, swapped);
+}
+#endif
+
+void copyIntCells(unsigned char* src, unsigned char* dst, size_t n, uint8_t swapped) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        copyIntCellsAVX2(src, dst, n, swapped);
+        return;
+    }
+    if (simdPath == PATH_SSSE3) {
+        copyIntCellsSSSE3(src, dst, n, swapped);
+        return;
+    }
+#endif
+    copyIntCellsScalar(src, dst, n, swapped);
+}
+
+void narrowIntCells(unsigned char* src, uint32_t* dst, size_t n, uint8_t swapped) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        narrowIntCellsAVX2(src, dst, n, swapped);
+        return;
+    }
+    if (simdPath == PATH_SSSE3) {
+        narrowIntCellsSSSE3(src, dst, n, swapped);
+        return;
+    }
+#endif
+    narrowIntCellsScalar(src, dst, n, swapped);
+}
+
+void widenIntCells(uint32_t* src, unsigned char* dst, size_t n, uint8_t swapped) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        widenIntCellsAVX2(src, dst, n, swapped);
+        return;
+    }
+    if (simdPath == PATH_SSSE3) {
+        widenIntCellsSSSE3(src, dst, n, swapped);
+        return;
+    }
+#endif
+    widenIntCellsScalar(src, dst, n, swapped);
+}
+
+void decCellsToFloat(unsigned char* src, float* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (float) decodeDec(src + i*16, decSwapped, decWholeFirst, decFracScale);
+    }
+}
+
+void floatToDecCells(float* src, unsigned char* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        encodeDec(dst + i*16, src[i], decSwapped, decWholeFirst, decFracScale);
+    }
+}
+
+void decCellsToDouble(unsigned char* src, double* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = decodeDec(src + i*16, decSwapped, decWholeFirst, decFracScale);
+    }
+}
+
+void doubleToDecCells(double* src, unsigned char* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        encodeDec(dst + i*16, src[i], decSwapped, decWholeFirst, decFracScale);
+    }
+}
+
+/*
+ * IEEE 754 binary16, rounding to nearest even. Values past the half
+ * range become infinities and values below it zeros
+ */
+uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(uint32_t));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t rawExp = (bits >> 23) & 0xFF;
+    uint32_t mant = bits & 0x7FFFFF;
+    int32_t exp = (int32_t) rawExp - 127 + 15;
+
+    if (rawExp == 0xFF) {
+        return (uint16_t) (sign | 0x7C00 | (mant ? 0x200 : 0));
+    }
+    if (exp >= 31) {
+        return (uint16_t) (sign | 0x7C00);
+    }
+    if (exp <= 0) {
+        if (exp < -10) {
+            return (uint16_t) sign;
+        }
+        //subnormal, the implicit bit becomes explicit
+        mant |= 0x800000;
+        uint32_t shift = 14 - exp;
+        uint32_t half = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1);
+        uint32_t mid = 1u << (shift - 1);
+        if (rem > mid || (rem == mid && (half & 1))) {
+            half++;
+        }
+        return (uint16_t) (sign | half);
+    }
+    //a carry out of the mantissa correctly rounds up the exponent
+    uint32_t half = sign | ((uint32_t) exp << 10) | (mant >> 13);
+    uint32_t rem = mant & 0x1FFF;
+    if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) {
+        half++;
+    }
+    return (uint16_t) half;
+}
+
+float halfToFloat(uint16_t half) {
+    uint32_t sign = (uint32_t) (half & 0x8000) << 16;
+    uint32_t exp = (half >> 10) & 0x1F;
+    uint32_t mant = half & 0x3FF;
+    uint32_t bits;
+    if (exp == 0x1F) {
+        bits = sign | 0x7F800000 | (mant << 13);
+    }
+    else if (exp == 0) {
+        if (mant == 0) {
+            bits = sign;
+        }
+        else {
+            //subnormal, normalised for the wider exponent
+            exp = 127 - 15 + 1;
+            while (!(mant & 0x400)) {
+                mant <<= 1;
+                exp--;
+            }
+            bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+        }
+    }
+    else {
+        bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+}
+
+void decCellsToHalf(unsigned char* src, uint16_t* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = floatToHalf((float) decodeDec(src + i*16, decSwapped, decWholeFirst, decFracScale));
+    }
+}
+
+void halfToDecCells(uint16_t* src, unsigned char* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        encodeDec(dst + i*16, halfToFloat(src[i]), decSwapped, decWholeFirst, decFracScale);
+    }
+}
+
+/*
+ * Int cells to and from the sized int types. Narrowing keeps the low
+ * bits; widening sign extends the signed types
+ */
+void narrowTypedCells(unsigned char* src, unsigned char* dst, size_t n, size_t type, uint8_t swapped) {
+    switch (type) {
+        case INT8:
+        case UINT8:
+            for (size_t i = 0; i < n; i++) {
+                ((uint8_t*) dst)[i] = (uint8_t) loadHalf(src + i*8, swapped);
+            }
+            break;
+        case INT16:
+        case UINT16:
+            for (size_t i = 0; i < n; i++) {
+                ((uint16_t*) dst)[i] = (uint16_t) loadHalf(src + i*8, swapped);
+            }
+            break;
+        case INT32:
+        case UINT32:
+            narrowIntCells(src, (uint32_t*) dst, n, swapped);
+            break;
+        default:
+            copyIntCells(src, dst, n, swapped);
+    }
+}
+
+void widenTypedCells(unsigned char* src, unsigned char* dst, size_t n, size_t type, uint8_t swapped) {
+    switch (type) {
+        case INT8:
+            for (size_t i = 0; i < n; i++) {
+                storeHalf(dst + i*8, (uint64_t) (int64_t) ((int8_t*) src)[i], swapped);
+            }
+            break;
+        case UINT8:
+            for (size_t i = 0; i < n; i++) {
+                storeHalf(dst + i*8, (uint64_t) ((uint8_t*) src)[i], swapped);
+            }
+            break;
+        case INT16:
+            for (size_t i = 0; i < n; i++) {
+                storeHalf(dst + i*8, (uint64_t) (int64_t) ((int16_t*) src)[i], swapped);
+            }
+            break;
+        case UINT16:
+            for (size_t i = 0; i < n; i++) {
+                storeHalf(dst + i*8, (uint64_t) ((uint16_t*) src)[i], swapped);
+            }
+            break;
+        case INT32:
+            for (size_t i = 0; i < n; i++) {
+                storeHalf(dst + i*8, (uint64_t) (int64_t) ((int32_t*) src)[i], swapped);
+            }
+            break;
+        case UINT32:
+            widenIntCells((uint32_t*) src, dst, n, swapped);
+            break;
+        default:
+            copyIntCells(src, dst, n, swapped);
+    }
+}
+
+//a single cell of a sized int type, for the per-cell paths
+void storeTypedInt(void* row, size_t j, size_t type, size_t value) {
+    switch (type) {
+        case INT8: case UINT8: ((uint8_t*) row)[j] = (uint8_t) value; break;
+        case INT16: case UINT16: ((uint16_t*) row)[j] = (uint16_t) value; break;
+        case INT32: case UINT32: ((uint32_t*) row)[j] = (uint32_t) value; break;
+        default: ((uint64_t*) row)[j] = (uint64_t) value;
+    }
+}
+
+size_t loadTypedInt(void* row, size_t j, size_t type) {
+    switch (type) {
+        case INT8: return (size_t) (int64_t) ((int8_t*) row)[j];
+        case UINT8: return ((uint8_t*) row)[j];
+        case INT16: return (size_t) (int64_t) ((int16_t*) row)[j];
+        case UINT16: return ((uint16_t*) row)[j];
+        case INT32: return (size_t) (int64_t) ((int32_t*) row)[j];
+        case UINT32: return ((uint32_t*) row)[j];
+        default: return (size_t) ((uint64_t*) row)[j];
+    }
+}
+
+/*
+ * A bulk conversion between dana content (cells of cellSize bytes,
+ * rows packed end to end) and raw memory whose rows are rowPitch
+ * bytes apart. Work is split by cell index, each range handing
+ * contiguous runs within a row to the run kernel
+ */
+#define BULK_INT_TO_SIZE_T 0
+#define BULK_SIZE_T_TO_INT 1
+#define BULK_INT_TO_U32 2
+#define BULK_U32_TO_INT 3
+#define BULK_DEC_TO_FLOAT 4
+#define BULK_FLOAT_TO_DEC 5
+#define BULK_DEC_TO_DOUBLE 6
+#define BULK_DOUBLE_TO_DEC 7
+#define BULK_INT_TO_TYPED 8
+#define BULK_TYPED_TO_INT 9
+#define BULK_DEC_TO_HALF 10
+#define BULK_HALF_TO_DEC 11
+
+typedef struct _bulk_job {
+    uint8_t op;
+    //sized int type of the TYPED ops
+    size_t type;
+    unsigned char* dana;
+    unsigned char* raw;
+    size_t cols;
+    size_t rowPitch;
+    size_t from;
+    size_t to;
+} BULK_JOB;
+
+size_t bulkCellSize(uint8_t op) {
+    uint8_t isDec = (op >= BULK_DEC_TO_FLOAT && op <= BULK_DOUBLE_TO_DEC) || op >= BULK_DEC_TO_HALF;
+    return isDec ? 16 : sizeof(size_t);
+}
+
+size_t bulkRawSize(uint8_t op, size_t type) {
+    switch (op) {
+        case BULK_INT_TO_SIZE_T: case BULK_SIZE_T_TO_INT: return sizeof(size_t);
+        case BULK_DEC_TO_DOUBLE: case BULK_DOUBLE_TO_DEC: return sizeof(double);
+        case BULK_INT_TO_TYPED: case BULK_TYPED_TO_INT: return elementSize(type, 1);
+        case BULK_DEC_TO_HALF: case BULK_HALF_TO_DEC: return sizeof(uint16_t);
+        default: return 4;
+    }
+}
+
+void* runBulkRange(void* arg) {
+    BULK_JOB* job = (BULK_JOB*) arg;
+    size_t cellSize = bulkCellSize(job->op);
+    size_t rawSize = bulkRawSize(job->op, job->type);
+    size_t i = job->from;
+    while (i < job->to) {
+        size_t row = i / job->cols;
+        size_t col = i % job->cols;
+        size_t run = job->cols - col;
+        if (run > job->to - i) {
+            run = job->to - i;
+        }
+        unsigned char* danaRun = job->dana + i*cellSize;
+        unsigned char* rawRun = job->raw + row*job->rowPitch + col*rawSize;
+        switch (job->op) {
+            case BULK_INT_TO_SIZE_T:
+                copyIntCells(danaRun, rawRun, run, intSwapped);
+                break;
+            case BULK_SIZE_T_TO_INT:
+                copyIntCells(rawRun, danaRun, run, intSwapped);
+                break;
+            case BULK_INT_TO_U32:
+                narrowIntCells(danaRun, (uint32_t*) rawRun, run, intSwapped);
+                break;
+            case BULK_U32_TO_INT:
+                widenIntCells((uint32_t*) rawRun, danaRun, run, intSwapped);
+                break;
+            case BULK_DEC_TO_FLOAT:
+                decCellsToFloat(danaRun, (float*) rawRun, run);
+                break;
+            case BULK_FLOAT_TO_DEC:
+                floatToDecCells((float*) rawRun, danaRun, run);
+                break;
+            case BULK_DEC_TO_DOUBLE:
+                decCellsToDouble(danaRun, (double*) rawRun, run);
+                break;
+            case BULK_DOUBLE_TO_DEC:
+                doubleToDecCells((double*) rawRun, danaRun, run);
+                break;
+            case BULK_INT_TO_TYPED:
+                narrowTypedCells(danaRun, rawRun, run, job->type, intSwapped);
+                break;
+            case BULK_TYPED_TO_INT:
+                widenTypedCells(rawRun, danaRun, run, job->type, intSwapped);
+                break;
+            case BULK_DEC_TO_HALF:
+                decCellsToHalf(danaRun, (uint16_t*) rawRun, run);
+                break;
+            case BULK_HALF_TO_DEC:
+                halfToDecCells((uint16_t*) rawRun, danaRun, run);
+                break;
+        }
+        i += run;
+    }
+    return NULL;
+}
+
+void runBulkTyped(uint8_t op, size_t type, unsigned char* dana, void* raw, size_t rows, size_t cols, size_t rowPitch) {
+    size_t cells = rows*cols;
+    BULK_JOB jobs[BULK_MAX_THREADS];
+    pthread_t threads[BULK_MAX_THREADS];
+    size_t threadCount = cells >= BULK_THREAD_THRESHOLD ? bulkThreads : 1;
+    size_t per = (cells + threadCount - 1) / threadCount;
+
+    for (size_t t = 0; t < threadCount; t++) {
+        jobs[t] = (BULK_JOB) {op, type, dana, (unsigned char*) raw, cols, rowPitch, t*per, (t+1)*per > cells ? cells : (t+1)*per};
+    }
+    //the calling thread takes the first range itself
+    size_t started = 1;
+    for (size_t t = 1; t < threadCount; t++) {
+        if (pthread_create(&threads[t], NULL, runBulkRange, &jobs[t]) != 0) {
+            break;
+        }
+        started++;
+    }
+    runBulkRange(&jobs[0]);
+    for (size_t t = 1; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    //any range a thread couldn't be started for
+    for (size_t t = started; t < threadCount; t++) {
+        runBulkRange(&jobs[t]);
+    }
+}
+
+void runBulk(uint8_t op, unsigned char* dana, void* raw, size_t rows, size_t cols, size_t rowPitch) {
+    runBulkTyped(op, UINT, dana, raw, rows, cols, rowPitch);
+}
+
+uint8_t bulkInt() {
+    return bulkEnabled && intLayoutKnown;
+}
+
+uint8_t bulkDec() {
+    return bulkEnabled && decLayoutKnown;
+}
+
+double probeDecValues[] = {1.5, -2.25, 0.1, 123456.75, -0.5, 3.0, 1e-6, -98765.125};
+#define PROBE_DEC_COUNT (sizeof(probeDecValues)/sizeof(double))
+
+uint8_t closeEnough(double a, double b) {
+    double diff = a > b ? a - b : b - a;
+    return diff <= 1e-9 * (1 + (b > 0 ? b : -b));
+}
+
+void probeIntLayout() {
+    size_t probeValues[] = {(size_t) 0x0102030405060708ULL, 1, (size_t) 0x8000000000000001ULL, 0xFFFFFFFF};
+    size_t count = sizeof(probeValues)/sizeof(size_t);
+    if (sizeof(size_t) != sizeof(uint64_t)) {
+        return;
+    }
+    DanaEl* probe = api->makeArray(intArrayGT, count, NULL);
+    for (int i = 0; i < count; i++) {
+        api->setArrayCellInt(probe, i, probeValues[i]);
+    }
+    unsigned char* content = api->getArrayContent(probe);
+    for (uint8_t swapped = 0; swapped < 2 && !intLayoutKnown; swapped++) {
+        uint8_t match = 1;
+        for (int i = 0; i < count && match; i++) {
+            match = loadHalf(content + i*8, swapped) == (uint64_t) probeValues[i];
+        }
+        if (match) {
+            intLayoutKnown = 1;
+            intSwapped = swapped;
+        }
+    }
+    //check the other direction too
+    if (intLayoutKnown) {
+        for (int i = 0; i < count; i++) {
+            storeHalf(content + i*8, (uint64_t) probeValues[count-1-i], intSwapped);
+        }
+        for (int i = 0; i < count && intLayoutKnown; i++) {
+            intLayoutKnown = api->getArrayCellInt(probe, i) == probeValues[count-1-i];
+        }
+    }
+    api->destroyArray(probe);
+}
+
+void probeDecLayout() {
+    double scales[] = {18446744073709551616.0, 1e18, 1e19, 1e16, 1e9};
+    size_t scaleCount = sizeof(scales)/sizeof(double);
+
+    DanaEl* probe = api->makeArray(decArrayGT, PROBE_DEC_COUNT, NULL);
+    for (int i = 0; i < PROBE_DEC_COUNT; i++) {
+        api->setArrayCellDec(probe, i, probeDecValues[i]);
+    }
+    unsigned char* content = api->getArrayContent(probe);
+    for (size_t s = 0; s < scaleCount && !decLayoutKnown; s++) {
+        for (uint8_t swapped = 0; swapped < 2 && !decLayoutKnown; swapped++) {
+            for (uint8_t wholeFirst = 0; wholeFirst < 2 && !decLayoutKnown; wholeFirst++) {
+                uint8_t match = 1;
+                for (int i = 0; i < PROBE_DEC_COUNT && match; i++) {
+                    match = closeEnough(decodeDec(content + i*16, swapped, wholeFirst, scales[s]), probeDecValues[i]);
+                }
+                if (match) {
+                    decLayoutKnown = 1;
+                    decSwapped = swapped;
+                    decWholeFirst = wholeFirst;
+                    decFracScale = scales[s];
+                }
+            }
+        }
+    }
+    if (decLayoutKnown) {
+        for (int i = 0; i < PROBE_DEC_COUNT; i++) {
+            encodeDec(content + i*16, probeDecValues[PROBE_DEC_COUNT-1-i], decSwapped, decWholeFirst, decFracScale);
+        }
+        for (int i = 0; i < PROBE_DEC_COUNT && decLayoutKnown; i++) {
+            decLayoutKnown = closeEnough(api->getArrayCellDec(probe, i), probeDecValues[PROBE_DEC_COUNT-1-i]);
+        }
+    }
+    api->destroyArray(probe);
+}
+
+void probeLayouts() {
+    probeIntLayout();
+    probeDecLayout();
+
+    simdPath = PATH_SCALAR;
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        simdPath = PATH_AVX2;
+    }
+    else if (__builtin_cpu_supports("ssse3")) {
+        simdPath = PATH_SSSE3;
+    }
+#endif
+
+#ifdef WINDOWS
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    long cpus = (long) sysInfo.dwNumberOfProcessors;
+#else
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    bulkThreads = cpus < 1 ? 1 : (cpus > BULK_MAX_THREADS ? BULK_MAX_THREADS : (size_t) cpus);
+    hostThreads = cpus < 1 ? 1 : (cpus > HOST_MAX_THREADS ? HOST_MAX_THREADS : (size_t) cpus);
+}
+
+/*
+ * Returns [marshal ns, transfer ns, bytes marshalled, int path, dec path]
+ * where a path is PATH_PER_CELL, PATH_SCALAR, PATH_SSSE3 or PATH_AVX2
+ */
+INSTRUCTION_DEF getTransferStats(FrameData* cframe) {
+    DanaEl* returnArray = api->makeArray(intArrayGT, 5, NULL);
+    api->setArrayCellInt(returnArray, 0, __atomic_load_n(&marshalNs, __ATOMIC_RELAXED));
+    api->setArrayCellInt(returnArray, 1, __atomic_load_n(&transferNs, __ATOMIC_RELAXED));
+    api->setArrayCellInt(returnArray, 2, __atomic_load_n(&bytesMarshalled, __ATOMIC_RELAXED));
+    api->setArrayCellInt(returnArray, 3, bulkInt() ? simdPath : PATH_PER_CELL);
+    api->setArrayCellInt(returnArray, 4, bulkDec() ? PATH_SCALAR : PATH_PER_CELL);
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF resetTransferStats(FrameData* cframe) {
+    __atomic_store_n(&marshalNs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&transferNs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&bytesMarshalled, 0, __ATOMIC_RELAXED);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF setBulkMarshalling(FrameData* cframe) {
+    bulkEnabled = api->getParamRaw(cframe, 0)[0] != 0;
+    return RETURN_OK;
+}
+
+/*
+ * Returns a monotonic timestamp in nanoseconds, for timing
+ * transfers and launches from dana
+ */
+INSTRUCTION_DEF getTimestamp(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) nowNs());
+    return RETURN_OK;
+}
+
+/*
+ * Marshalling between dana arrays and the raw host memory that is
+ * handed to opencl, which is either a staging buffer or a mapped
+ * region of the memory object itself. UINT int arrays are stored on
+ * the device as size_t and UINT int matrices as uint32
+ * (CL_UNSIGNED_INT32 images); the sized int types, floats, doubles and
+ * halfs are stored as their type. lens is {length} for an array and
+ * {rows, cols} for a matrix; rowPitch is the distance in bytes
+ * between the start of each matrix row in the raw memory. type is the
+ * element type, for the marshallers that handle more than one
+ */
+typedef void (*MARSHAL_FN)(DanaEl* host, size_t* lens, void* dest, size_t rowPitch, size_t type);
+typedef DanaEl* (*UNMARSHAL_FN)(void* src, size_t* lens, size_t rowPitch, size_t type);
+
+void marshalIntArray(DanaEl* hostArray, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkInt()) {
+        runBulk(BULK_INT_TO_SIZE_T, api->getArrayContent(hostArray), dest, 1, lens[0], rowPitch);
+        return;
+    }
+    size_t* raw = (size_t*) dest;
+    for (int i = 0; i < lens[0]; i++) {
+        raw[i] = api->getArrayCellInt(hostArray, i);
+    }
+}
+
+void marshalFloatArray(DanaEl* hostArray, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkDec()) {
+        runBulk(BULK_DEC_TO_FLOAT, api->getArrayContent(hostArray), dest, 1, lens[0], rowPitch);
+        return;
+    }
+    float* raw = (float*) dest;
+    for (int i = 0; i < lens[0]; i++) {
+        raw[i] = api->getArrayCellDec(hostArray, i);
+    }
+}
+
+void marshalIntMatrix(DanaEl* hostMatrix, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkInt()) {
+        runBulk(BULK_INT_TO_U32, api->getArrayContent(hostMatrix), dest, lens[0], lens[1], rowPitch);
+        return;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        uint32_t* row = (uint32_t*) ((char*) dest + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            row[j] = api->getArrayCellInt(hostMatrix, (i*lens[1])+j);
+        }
+    }
+}
+
+void marshalFloatMatrix(DanaEl* hostMatrix, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkDec()) {
+        runBulk(BULK_DEC_TO_FLOAT, api->getArrayContent(hostMatrix), dest, lens[0], lens[1], rowPitch);
+        return;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        float* row = (float*) ((char*) dest + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            row[j] = api->getArrayCellDec(hostMatrix, (i*lens[1])+j);
+        }
+    }
+}
+
+void marshalDoubleArray(DanaEl* hostArray, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkDec()) {
+        runBulk(BULK_DEC_TO_DOUBLE, api->getArrayContent(hostArray), dest, 1, lens[0], rowPitch);
+        return;
+    }
+    double* raw = (double*) dest;
+    for (int i = 0; i < lens[0]; i++) {
+        raw[i] = api->getArrayCellDec(hostArray, i);
+    }
+}
+
+void marshalDoubleMatrix(DanaEl* hostMatrix, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (bulkDec()) {
+        runBulk(BULK_DEC_TO_DOUBLE, api->getArrayContent(hostMatrix), dest, lens[0], lens[1], rowPitch);
+        return;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        double* row = (double*) ((char*) dest + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            row[j] = api->getArrayCellDec(hostMatrix, (i*lens[1])+j);
+        }
+    }
+}
+
+DanaEl* unmarshalIntArray(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    size_t* raw = (size_t*) src;
+    unsigned char* content = NULL;
+    DanaEl* hostArray = api->makeArray(intArrayGT, lens[0], &content);
+    if (bulkInt()) {
+        runBulk(BULK_SIZE_T_TO_INT, content, src, 1, lens[0], rowPitch);
+        return hostArray;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        api->setArrayCellInt(hostArray, i, raw[i]);
+    }
+    return hostArray;
+}
+
+DanaEl* unmarshalFloatArray(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    float* raw = (float*) src;
+    unsigned char* content = NULL;
+    DanaEl* hostArray = api->makeArray(decArrayGT, lens[0], &content);
+    if (bulkDec()) {
+        runBulk(BULK_FLOAT_TO_DEC, content, src, 1, lens[0], rowPitch);
+        return hostArray;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        api->setArrayCellDec(hostArray, i, raw[i]);
+    }
+    return hostArray;
+}
+
+DanaEl* unmarshalIntMatrix(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    unsigned char* content = NULL;
+    DanaEl* hostMatrix = api->makeArrayMD(intMatrixGT, 2, lens, &content);
+    if (bulkInt()) {
+        runBulk(BULK_U32_TO_INT, content, src, lens[0], lens[1], rowPitch);
+        return hostMatrix;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        uint32_t* row = (uint32_t*) ((char*) src + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            api->setArrayCellInt(hostMatrix, (i*lens[1])+j, row[j]);
+        }
+    }
+    return hostMatrix;
+}
+
+DanaEl* unmarshalFloatMatrix(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    unsigned char* content = NULL;
+    DanaEl* hostMatrix = api->makeArrayMD(decMatrixGT, 2, lens, &content);
+    if (bulkDec()) {
+        runBulk(BULK_FLOAT_TO_DEC, content, src, lens[0], lens[1], rowPitch);
+        return hostMatrix;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        float* row = (float*) ((char*) src + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            api->setArrayCellDec(hostMatrix, (i*lens[1])+j, row[j]);
+        }
+    }
+    return hostMatrix;
+}
+
+DanaEl* unmarshalDoubleArray(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    double* raw = (double*) src;
+    unsigned char* content = NULL;
+    DanaEl* hostArray = api->makeArray(decArrayGT, lens[0], &content);
+    if (bulkDec()) {
+        runBulk(BULK_DOUBLE_TO_DEC, content, src, 1, lens[0], rowPitch);
+        return hostArray;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        api->setArrayCellDec(hostArray, i, raw[i]);
+    }
+    return hostArray;
+}
+
+DanaEl* unmarshalDoubleMatrix(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    unsigned char* content = NULL;
+    DanaEl* hostMatrix = api->makeArrayMD(decMatrixGT, 2, lens, &content);
+    if (bulkDec()) {
+        runBulk(BULK_DOUBLE_TO_DEC, content, src, lens[0], lens[1], rowPitch);
+        return hostMatrix;
+    }
+    for (int i = 0; i < lens[0]; i++) {
+        double* row = (double*) ((char*) src + i*rowPitch);
+        for (int j = 0; j < lens[1]; j++) {
+            api->setArrayCellDec(hostMatrix, (i*lens[1])+j, row[j]);
+        }
+    }
+    return hostMatrix;
+}
+
+void marshalTypedInt(DanaEl* host, size_t rows, size_t cols, void* dest, size_t rowPitch, size_t type) {
+    if (bulkInt()) {
+        runBulkTyped(BULK_INT_TO_TYPED, type, api->getArrayContent(host), dest, rows, cols, rowPitch);
+        return;
+    }
+    for (int i = 0; i < rows; i++) {
+        void* row = (char*) dest + i*rowPitch;
+        for (int j = 0; j < cols; j++) {
+            storeTypedInt(row, j, type, api->getArrayCellInt(host, (i*cols)+j));
+        }
+    }
+}
+
+void unmarshalTypedInt(void* src, unsigned char* content, DanaEl* host, size_t rows, size_t cols, size_t rowPitch, size_t type) {
+    if (bulkInt()) {
+        runBulkTyped(BULK_TYPED_TO_INT, type, content, src, rows, cols, rowPitch);
+        return;
+    }
+    for (int i = 0; i < rows; i++) {
+        void* row = (char*) src + i*rowPitch;
+        for (int j = 0; j < cols; j++) {
+            api->setArrayCellInt(host, (i*cols)+j, loadTypedInt(row, j, type));
+        }
+    }
+}
+
+/*
+ * The int marshallers for any int type, UINT keeps its own
+ */
+void marshalTypedIntArray(DanaEl* hostArray, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (type == UINT) {
+        marshalIntArray(hostArray, lens, dest, rowPitch, type);
+        return;
+    }
+    marshalTypedInt(hostArray, 1, lens[0], dest, rowPitch, type);
+}
+
+void marshalTypedIntMatrix(DanaEl* hostMatrix, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    if (type == UINT) {
+        marshalIntMatrix(hostMatrix, lens, dest, rowPitch, type);
+        return;
+    }
+    marshalTypedInt(hostMatrix, lens[0], lens[1], dest, rowPitch, type);
+}
+
+DanaEl* unmarshalTypedIntArray(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    if (type == UINT) {
+        return unmarshalIntArray(src, lens, rowPitch, type);
+    }
+    unsigned char* content = NULL;
+    DanaEl* hostArray = api->makeArray(intArrayGT, lens[0], &content);
+    unmarshalTypedInt(src, content, hostArray, 1, lens[0], rowPitch, type);
+    return hostArray;
+}
+
+DanaEl* unmarshalTypedIntMatrix(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    if (type == UINT) {
+        return unmarshalIntMatrix(src, lens, rowPitch, type);
+    }
+    unsigned char* content = NULL;
+    DanaEl* hostMatrix = api->makeArrayMD(intMatrixGT, 2, lens, &content);
+    unmarshalTypedInt(src, content, hostMatrix, lens[0], lens[1], rowPitch, type);
+    return hostMatrix;
+}
+
+void marshalHalf(DanaEl* host, size_t rows, size_t cols, void* dest, size_t rowPitch) {
+    if (bulkDec()) {
+        runBulk(BULK_DEC_TO_HALF, api->getArrayContent(host), dest, rows, cols, rowPitch);
+        return;
+    }
+    for (int i = 0; i < rows; i++) {
+        uint16_t* row = (uint16_t*) ((char*) dest + i*rowPitch);
+        for (int j = 0; j < cols; j++) {
+            row[j] = floatToHalf((float) api->getArrayCellDec(host, (i*cols)+j));
+        }
+    }
+}
+
+void unmarshalHalf(void* src, unsigned char* content, DanaEl* host, size_t rows, size_t cols, size_t rowPitch) {
+    if (bulkDec()) {
+        runBulk(BULK_HALF_TO_DEC, content, src, rows, cols, rowPitch);
+        return;
+    }
+    for (int i = 0; i < rows; i++) {
+        uint16_t* row = (uint16_t*) ((char*) src + i*rowPitch);
+        for (int j = 0; j < cols; j++) {
+            api->setArrayCellDec(host, (i*cols)+j, halfToFloat(row[j]));
+        }
+    }
+}
+
+void marshalHalfArray(DanaEl* hostArray, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    marshalHalf(hostArray, 1, lens[0], dest, rowPitch);
+}
+
+void marshalHalfMatrix(DanaEl* hostMatrix, size_t* lens, void* dest, size_t rowPitch, size_t type) {
+    marshalHalf(hostMatrix, lens[0], lens[1], dest, rowPitch);
+}
+
+DanaEl* unmarshalHalfArray(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    unsigned char* content = NULL;
+    DanaEl* hostArray = api->makeArray(decArrayGT, lens[0], &content);
+    unmarshalHalf(src, content, hostArray, 1, lens[0], rowPitch);
+    return hostArray;
+}
+
+DanaEl* unmarshalHalfMatrix(void* src, size_t* lens, size_t rowPitch, size_t type) {
+    unsigned char* content = NULL;
+    DanaEl* hostMatrix = api->makeArrayMD(decMatrixGT, 2, lens, &content);
+    unmarshalHalf(src, content, hostMatrix, lens[0], lens[1], rowPitch);
+    return hostMatrix;
+}
+
+/*
+ * Marshals into a newly allocated staging buffer with tightly packed rows
+ */
+//host time the calling thread's last marshalToStaging took, profiled with
+//the write it was for
+__thread uint64_t stagingNs = 0;
+
+void* marshalToStaging(MARSHAL_FN marshal, DanaEl* host, size_t* lens, size_t lenCount, size_t elementSize, size_t type) {
+    uint64_t start = nowNs();
+    size_t rows = lenCount == 2 ? lens[0] : 1;
+    size_t rowLen = lenCount == 2 ? lens[1] : lens[0];
+    void* staging = malloc(elementSize*rows*rowLen);
+    marshal(host, lens, staging, elementSize*rowLen, type);
+    stagingNs = nowNs() - start;
+    return staging;
+}
+
+/*
+ * Matrices (lens is {rows, cols}) may be images or buffers, see
+ * createMatrix
+ */
+uint8_t isImage(cl_mem memObj) {
+    cl_mem_object_type type = CL_MEM_OBJECT_BUFFER;
+    clGetMemObjectInfo(memObj, CL_MEM_TYPE, sizeof(cl_mem_object_type), &type, NULL);
+    return type == CL_MEM_OBJECT_IMAGE2D;
+}
+
+/*
+ * Bytes between the starts of consecutive rows of a buffer matrix.
+ * Rows are padded to the largest base address alignment of the
+ * context's devices, so every row starts where the device can load it
+ * in whole transactions. Pooled buffers may be larger than asked for,
+ * so the pitch is worked out from the context rather than the buffer
+ */
+size_t contextRowPitch(cl_context context, size_t cols, size_t elementSize) {
+    cl_uint numDevices = 0;
+    clGetContextInfo(context, CL_CONTEXT_NUM_DEVICES, sizeof(cl_uint), &numDevices, NULL);
+    cl_device_id* devices = (cl_device_id*) malloc(sizeof(cl_device_id)*numDevices);
+    clGetContextInfo(context, CL_CONTEXT_DEVICES, sizeof(cl_device_id)*numDevices, devices, NULL);
+    size_t align = elementSize;
+    for (int i = 0; i < numDevices; i++) {
+        cl_uint alignBits = 0;
+        clGetDeviceInfo(devices[i], CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &alignBits, NULL);
+        if (alignBits/8 > align) {
+            align = alignBits/8;
+        }
+    }
+    free(devices);
+    size_t rowBytes = cols*elementSize;
+    return ((rowBytes + align - 1)/align)*align;
+}
+
+size_t bufferRowPitch(cl_mem memObj, size_t cols, size_t elementSize) {
+    cl_context context;
+    clGetMemObjectInfo(memObj, CL_MEM_CONTEXT, sizeof(cl_context), &context, NULL);
+    return contextRowPitch(context, cols, elementSize);
+}
+
+size_t regionBytes(size_t* lens, size_t lenCount, size_t elementSize) {
+    return elementSize*lens[0]*(lenCount == 2 ? lens[1] : 1);
+}
+
+/*
+ * Enqueues a transfer between host memory, always tightly packed, and
+ * a buffer (lens has one entry), a 2d image (lens is {rows, cols}) or a
+ * buffer matrix, whose pitched rows are copied as a rectangle. Copies
+ * to and from host device memory are done before returning, with no
+ * event
+ */
+cl_int enqueueWrite(cl_command_queue queue, cl_mem memObj, cl_bool blocking, size_t* lens, size_t lenCount, size_t elementSize, void* host, cl_uint numWait, cl_event* waitList, cl_event* event) {
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        if (event != NULL) {
+            *event = NULL;
+        }
+        return hostCopyIn(hostMem, lens, lenCount, host);
+    }
+    if (lenCount == 1) {
+        return clEnqueueWriteBuffer(queue, memObj, blocking, 0, regionBytes(lens, lenCount, elementSize), host, numWait, waitList, event);
+    }
+    size_t origin[] = {0, 0, 0};
+    if (!isImage(memObj)) {
+        size_t region[] = {lens[1]*elementSize, lens[0], 1};
+        return clEnqueueWriteBufferRect(queue, memObj, blocking, origin, origin, region, bufferRowPitch(memObj, lens[1], elementSize), 0, lens[1]*elementSize, 0, host, numWait, waitList, event);
+    }
+    size_t region[] = {lens[1], lens[0], 1};
+    return clEnqueueWriteImage(queue, memObj, blocking, origin, region, 0, 0, host, numWait, waitList, event);
+}
+
+cl_int enqueueRead(cl_command_queue queue, cl_mem memObj, cl_bool blocking, size_t* lens, size_t lenCount, size_t elementSize, void* host, cl_uint numWait, cl_event* waitList, cl_event* event) {
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        if (event != NULL) {
+            *event = NULL;
+        }
+        return hostCopyOut(hostMem, lens, lenCount, host);
+    }
+    if (lenCount == 1) {
+        return clEnqueueReadBuffer(queue, memObj, blocking, 0, regionBytes(lens, lenCount, elementSize), host, numWait, waitList, event);
+    }
+    size_t origin[] = {0, 0, 0};
+    if (!isImage(memObj)) {
+        size_t region[] = {lens[1]*elementSize, lens[0], 1};
+        return clEnqueueReadBufferRect(queue, memObj, blocking, origin, origin, region, bufferRowPitch(memObj, lens[1], elementSize), 0, lens[1]*elementSize, 0, host, numWait, waitList, event);
+    }
+    size_t region[] = {lens[1], lens[0], 1};
+    return clEnqueueReadImage(queue, memObj, blocking, origin, region, 0, 0, host, numWait, waitList, event);
+}
+
+char* writeCall(cl_mem memObj, size_t lenCount) {
+    if (findHostMem(memObj) != NULL) {
+        return "hostCopyIn";
+    }
+    if (lenCount == 1) {
+        return "clEnqueueWriteBuffer";
+    }
+    return isImage(memObj) ? "clEnqueueWriteImage" : "clEnqueueWriteBufferRect";
+}
+
+char* readCall(cl_mem memObj, size_t lenCount) {
+    if (findHostMem(memObj) != NULL) {
+        return "hostCopyOut";
+    }
+    if (lenCount == 1) {
+        return "clEnqueueReadBuffer";
+    }
+    return isImage(memObj) ? "clEnqueueReadImage" : "clEnqueueReadBufferRect";
+}
+
+/*
+ * Memory objects allocated as MEM_MAPPED live in host accessible
+ * memory, so rather than staging a copy they are mapped and dana
+ * arrays are marshalled straight into (or out of) the mapping
+ */
+uint8_t isMapped(cl_mem memObj) {
+    cl_mem_flags flags = 0;
+    clGetMemObjectInfo(memObj, CL_MEM_FLAGS, sizeof(cl_mem_flags), &flags, NULL);
+    return (flags & CL_MEM_ALLOC_HOST_PTR) != 0;
+}
+
+/*
+ * Blocking map of the region described by lens. Sets rowPitch to the
+ * distance between rows of a mapped image or buffer matrix, or the
+ * length of an array
+ */
+void* mapRegion(cl_command_queue queue, cl_mem memObj, cl_map_flags mapFlags, size_t* lens, size_t lenCount, size_t elementSize, size_t* rowPitch, cl_int* CL_err) {
+    if (lenCount == 1 || !isImage(memObj)) {
+        size_t mapBytes = regionBytes(lens, lenCount, elementSize);
+        *rowPitch = lens[0]*elementSize;
+        if (lenCount == 2) {
+            //the padding after the last row isn't part of the matrix
+            *rowPitch = bufferRowPitch(memObj, lens[1], elementSize);
+            mapBytes = lens[0] == 0 ? 0 : (*rowPitch)*(lens[0] - 1) + lens[1]*elementSize;
+        }
+        void* mapped = clEnqueueMapBuffer(queue, memObj, CL_TRUE, mapFlags, 0, mapBytes, 0, NULL, NULL, CL_err);
+        if (*CL_err != CL_SUCCESS) {
+            addLog("clEnqueueMapBuffer", *CL_err, memObj);
+        }
+        return mapped;
+    }
+    size_t origin[] = {0, 0, 0};
+    size_t region[] = {lens[1], lens[0], 1};
+    size_t slicePitch = 0;
+    void* mapped = clEnqueueMapImage(queue, memObj, CL_TRUE, mapFlags, origin, region, rowPitch, &slicePitch, 0, NULL, NULL, CL_err);
+    if (*CL_err != CL_SUCCESS) {
+        addLog("clEnqueueMapImage", *CL_err, memObj);
+    }
+    return mapped;
+}
+
+cl_int unmapRegion(cl_command_queue queue, cl_mem memObj, void* mapped) {
+    cl_event unmapEvent;
+    cl_int CL_err = clEnqueueUnmapMemObject(queue, memObj, mapped, 0, NULL, &unmapEvent);
+    if (CL_err != CL_SUCCESS) {
+        addLog("clEnqueueUnmapMemObject", CL_err, memObj);
+        return CL_err;
+    }
+    clWaitForEvents(1, &unmapEvent);
+    clReleaseEvent(unmapEvent);
+    return CL_SUCCESS;
+}
+
+/*
+ * Blocking transfer of a dana array/matrix into memObj.
+ * Returns 0 on success, 1 on failure
+ */
+int transferIn(cl_command_queue queue, cl_mem memObj, DanaEl* host, size_t* lens, size_t lenCount, size_t elementSize, MARSHAL_FN marshal, size_t type) {
+    cl_int CL_err = CL_SUCCESS;
+    uint64_t start = nowNs();
+    __atomic_fetch_add(&bytesMarshalled, regionBytes(lens, lenCount, elementSize), __ATOMIC_RELAXED);
+    //host device memory is marshalled into directly, as a mapping is
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        if (hostMem->elementSize != elementSize || !hostRegionFits(hostMem, lens, lenCount)) {
+            addLog("transferIn", CL_INVALID_VALUE, memObj);
+            return 1;
+        }
+        marshal(host, lens, hostMem->data, lenCount == 2 ? hostMem->rowPitch : lens[0]*elementSize, type);
+        __atomic_fetch_add(&marshalNs, nowNs() - start, __ATOMIC_RELAXED);
+        recordProfile("write", NULL, regionBytes(lens, lenCount, elementSize), nowNs() - start);
+        return 0;
+    }
+    if (isMapped(memObj)) {
+        size_t rowPitch = 0;
+        void* mapped = mapRegion(queue, memObj, CL_MAP_WRITE_INVALIDATE_REGION, lens, lenCount, elementSize, &rowPitch, &CL_err);
+        if (CL_err != CL_SUCCESS) {
+            return 1;
+        }
+        uint64_t mappedAt = nowNs();
+        marshal(host, lens, mapped, rowPitch, type);
+        uint64_t marshalledAt = nowNs();
+        CL_err = unmapRegion(queue, memObj, mapped);
+        __atomic_fetch_add(&marshalNs, marshalledAt - mappedAt, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&transferNs, (mappedAt - start) + (nowNs() - marshalledAt), __ATOMIC_RELAXED);
+        recordProfile("write", NULL, regionBytes(lens, lenCount, elementSize), marshalledAt - mappedAt);
+        return CL_err == CL_SUCCESS ? 0 : 1;
+    }
+
+    void* staging = marshalToStaging(marshal, host, lens, lenCount, elementSize, type);
+    uint64_t marshalledAt = nowNs();
+    cl_event event = NULL;
+    CL_err = enqueueWrite(queue, memObj, CL_TRUE, lens, lenCount, elementSize, staging, 0, NULL, profilingOn ? &event : NULL);
+    free(staging);
+    __atomic_fetch_add(&marshalNs, marshalledAt - start, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&transferNs, nowNs() - marshalledAt, __ATOMIC_RELAXED);
+    if (CL_err != CL_SUCCESS) {
+        addLog(writeCall(memObj, lenCount), CL_err, memObj);
+        return 1;
+    }
+    if (event != NULL) {
+        recordProfile("write", event, regionBytes(lens, lenCount, elementSize), marshalledAt - start);
+        clReleaseEvent(event);
+    }
+    return 0;
+}
+
+/*
+ * Blocking transfer of memObj into a new dana array/matrix.
+ * Returns NULL on failure
+ */
+DanaEl* transferOut(cl_command_queue queue, cl_mem memObj, size_t* lens, size_t lenCount, size_t elementSize, UNMARSHAL_FN unmarshal, size_t type) {
+    cl_int CL_err = CL_SUCCESS;
+    uint64_t start = nowNs();
+    __atomic_fetch_add(&bytesMarshalled, regionBytes(lens, lenCount, elementSize), __ATOMIC_RELAXED);
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        if (hostMem->elementSize != elementSize || !hostRegionFits(hostMem, lens, lenCount)) {
+            addLog("transferOut", CL_INVALID_VALUE, memObj);
+            return NULL;
+        }
+        DanaEl* result = unmarshal(hostMem->data, lens, lenCount == 2 ? hostMem->rowPitch : lens[0]*elementSize, type);
+        __atomic_fetch_add(&marshalNs, nowNs() - start, __ATOMIC_RELAXED);
+        recordProfile("read", NULL, regionBytes(lens, lenCount, elementSize), nowNs() - start);
+        return result;
+    }
+    if (isMapped(memObj)) {
+        size_t rowPitch = 0;
+        void* mapped = mapRegion(queue, memObj, CL_MAP_READ, lens, lenCount, elementSize, &rowPitch, &CL_err);
+        if (CL_err != CL_SUCCESS) {
+            return NULL;
+        }
+        uint64_t mappedAt = nowNs();
+        DanaEl* result = unmarshal(mapped, lens, rowPitch, type);
+        uint64_t unmarshalledAt = nowNs();
+        unmapRegion(queue, memObj, mapped);
+        __atomic_fetch_add(&marshalNs, unmarshalledAt - mappedAt, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&transferNs, (mappedAt - start) + (nowNs() - unmarshalledAt), __ATOMIC_RELAXED);
+        recordProfile("read", NULL, regionBytes(lens, lenCount, elementSize), unmarshalledAt - mappedAt);
+        return result;
+    }
+
+    size_t rowLen = lenCount == 2 ? lens[1] : lens[0];
+    size_t rows = lenCount == 2 ? lens[0] : 1;
+    void* staging = malloc(elementSize*rows*rowLen);
+    cl_event event = NULL;
+    CL_err = enqueueRead(queue, memObj, CL_TRUE, lens, lenCount, elementSize, staging, 0, NULL, profilingOn ? &event : NULL);
+    if (CL_err != CL_SUCCESS) {
+        addLog(readCall(memObj, lenCount), CL_err, memObj);
+        free(staging);
+        return NULL;
+    }
+    uint64_t readAt = nowNs();
+    DanaEl* result = unmarshal(staging, lens, elementSize*rowLen, type);
+    free(staging);
+    uint64_t unmarshalledAt = nowNs();
+    __atomic_fetch_add(&transferNs, readAt - start, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&marshalNs, unmarshalledAt - readAt, __ATOMIC_RELAXED);
+    if (event != NULL) {
+        recordProfile("read", event, regionBytes(lens, lenCount, elementSize), unmarshalledAt - readAt);
+        clReleaseEvent(event);
+    }
+    return result;
+}
+
+INSTRUCTION_DEF writeIntArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+    size_t type = api->getParamInt(cframe, 3);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostArray, &hostArrayLen, 1, elementSize(type, 1), marshalTypedIntArray, type));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF readIntArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    size_t hostArrayLen = api->getParamInt(cframe, 2);
+    size_t type = api->getParamInt(cframe, 3);
+
+    api->returnEl(cframe, transferOut(queue, memObj, &hostArrayLen, 1, elementSize(type, 1), unmarshalTypedIntArray, type));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF writeFloatArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostArray, &hostArrayLen, 1, sizeof(float), marshalFloatArray, FLOAT));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF readFloatArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    size_t hostArrayLen = api->getParamInt(cframe, 2);
+
+    api->returnEl(cframe, transferOut(queue, memObj, &hostArrayLen, 1, sizeof(float), unmarshalFloatArray, FLOAT));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF writeDoubleArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostArray, &hostArrayLen, 1, sizeof(double), marshalDoubleArray, DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF readDoubleArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    size_t hostArrayLen = api->getParamInt(cframe, 2);
+
+    api->returnEl(cframe, transferOut(queue, memObj, &hostArrayLen, 1, sizeof(double), unmarshalDoubleArray, DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeHalfArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostArray, &hostArrayLen, 1, sizeof(uint16_t), marshalHalfArray, HALF));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF readHalfArray(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    size_t hostArrayLen = api->getParamInt(cframe, 2);
+
+    api->returnEl(cframe, transferOut(queue, memObj, &hostArrayLen, 1, sizeof(uint16_t), unmarshalHalfArray, HALF));
+    return RETURN_OK;
+}
+
+/*
+ * Matrices are 2d images (LAYOUT_IMAGE), read through samplers, or
+ * plain buffers of rows padded to the pitch given by contextRowPitch
+ * (LAYOUT_BUFFER), which kernels index directly and can tile through
+ * local memory. A matrix too large for an image on this device, or on
+ * a device without images, is made a buffer matrix instead
+ */
+/*
+ * Sets the single channel image format for the type, returning 0 for
+ * the types images can't hold (there are no 64 bit channel types)
+ */
+uint8_t imageFormat(size_t type, cl_image_format* form) {
+    cl_channel_type channel;
+    switch (type) {
+        case FLOAT: channel = CL_FLOAT; break;
+        case HALF: channel = CL_HALF_FLOAT; break;
+        case INT8: channel = CL_SIGNED_INT8; break;
+        case UINT8: channel = CL_UNSIGNED_INT8; break;
+        case INT16: channel = CL_SIGNED_INT16; break;
+        case UINT16: channel = CL_UNSIGNED_INT16; break;
+        case INT32: channel = CL_SIGNED_INT32; break;
+        case UINT: case UINT32: channel = CL_UNSIGNED_INT32; break;
+        default: return 0;
+    }
+    *form = (cl_image_format) {CL_R, channel};
+    return 1;
+}
+
+uint8_t fitsImage(cl_device_id device, size_t rows, size_t cols) {
+    cl_bool images = CL_FALSE;
+    size_t maxWidth = 0;
+    size_t maxHeight = 0;
+    clGetDeviceInfo(device, CL_DEVICE_IMAGE_SUPPORT, sizeof(cl_bool), &images, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_IMAGE2D_MAX_WIDTH, sizeof(size_t), &maxWidth, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_IMAGE2D_MAX_HEIGHT, sizeof(size_t), &maxHeight, NULL);
+    return images == CL_TRUE && cols <= maxWidth && rows <= maxHeight;
+}
+
+INSTRUCTION_DEF createMatrix(FrameData* cframe) {
+    cl_int CL_err = CL_SUCCESS;
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_device_id device = (cl_device_id) rawParam;
+
+    //always a buffer matrix, whatever layout was asked for
+    if (isHostDevice(device)) {
+        size_t type = api->getParamInt(cframe, 3);
+        HOST_MEM* mem = knownType(device, type) ? newHostMem(type, elementSize(type, 2), api->getParamInt(cframe, 1), api->getParamInt(cframe, 2), 1) : NULL;
+        if (mem == NULL) {
+            addLog("createMatrix", CL_OUT_OF_HOST_MEMORY, device);
+        }
+        api->returnInt(cframe, (size_t) mem);
+        return RETURN_OK;
+    }
+
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 6);
+    CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
+    cl_context context = contextItem->context;
+
+    rawParam = api->getParamInt(cframe, 1);
+    size_t rows = (size_t) rawParam;
+
+    cl_mem_flags flags = allocFlags(api->getParamInt(cframe, 4));
+
+    rawParam = api->getParamInt(cframe, 2);
+    size_t cols = (size_t) rawParam;
+
+    rawParam = api->getParamInt(cframe, 3);
+    size_t type = (size_t) rawParam;
+
+    size_t layout = api->getParamInt(cframe, 5);
+
+    cl_image_desc desc = {CL_MEM_OBJECT_IMAGE2D, cols, rows, 0, 1, 0, 0, 0, 0, NULL};
+    cl_image_format form;
+    if (!knownType(device, type)) {
+        addLog("createMatrix", CL_INVALID_VALUE, device);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+    if (!imageFormat(type, &form)) {
+        layout = LAYOUT_BUFFER;
+    }
+
+    if (layout == LAYOUT_IMAGE && !fitsImage(device, rows, cols)) {
+        layout = LAYOUT_BUFFER;
+    }
+
+    cl_mem newMatrix;
+    if (layout == LAYOUT_BUFFER) {
+        size_t pitch = contextRowPitch(context, cols, elementSize(type, 2));
+        newMatrix = poolAcquireBuffer(danaComp, context, flags, pitch*(rows > 0 ? rows : 1), &CL_err);
+    }
+    else {
+        newMatrix = poolAcquireImage(danaComp, context, flags, &form, &desc, &CL_err);
+    }
+
+    if (CL_err != CL_SUCCESS) {
+        addLog(layout == LAYOUT_BUFFER ? "clCreateBuffer" : "clCreateImage", CL_err, device);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+
+    api->returnInt(cframe, (size_t) newMatrix);
+
+    return RETURN_OK;
+}
+
+/*
+ * Returns the number of elements between the starts of consecutive
+ * rows of a buffer matrix of the given type with 'cols' columns,
+ * or 0 for an image
+ */
+INSTRUCTION_DEF getMatrixRowPitch(FrameData* cframe) {
+    cl_mem memObj = (cl_mem) api->getParamInt(cframe, 0);
+    size_t cols = api->getParamInt(cframe, 1);
+    size_t size = elementSize(api->getParamInt(cframe, 2), 2);
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        api->returnInt(cframe, hostMem->rowPitch/size);
+        return RETURN_OK;
+    }
+    if (isImage(memObj)) {
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+    api->returnInt(cframe, bufferRowPitch(memObj, cols, size)/size);
+    return RETURN_OK;
+}
+
+/*
+ * Returns a buffer matrix that is rows [startRow, startRow + rows) of
+ * the buffer matrix memObj, sharing its memory, or 0 on failure. Rows
+ * start on the devices' base address alignment (see contextRowPitch),
+ * so any row can start a sub-buffer. A view of a view is made from the
+ * root buffer, as sub-buffers can't be nested
+ */
+INSTRUCTION_DEF createRowView(FrameData* cframe) {
+    cl_int CL_err = CL_SUCCESS;
+    cl_mem memObj = (cl_mem) api->getParamInt(cframe, 0);
+    size_t startRow = api->getParamInt(cframe, 1);
+    size_t rows = api->getParamInt(cframe, 2);
+    size_t cols = api->getParamInt(cframe, 3);
+    size_t size = elementSize(api->getParamInt(cframe, 4), 2);
+
+    HOST_MEM* hostMem = findHostMem(memObj);
+    if (hostMem != NULL) {
+        if (rows == 0 || startRow + rows > hostMem->rows || cols*size > hostMem->rowPitch) {
+            addLog("createRowView", CL_INVALID_VALUE, memObj);
+            api->returnInt(cframe, (size_t) 0);
+            return RETURN_OK;
+        }
+        HOST_MEM* view = (HOST_MEM*) malloc(sizeof(HOST_MEM));
+        *view = *hostMem;
+        view->rows = rows;
+        view->data = hostMem->data + startRow*hostMem->rowPitch;
+        view->ownsData = 0;
+        pthread_mutex_lock(&hostHandleLock);
+        view->next = hostMems;
+        hostMems = view;
+        pthread_mutex_unlock(&hostHandleLock);
+        api->returnInt(cframe, (size_t) view);
+        return RETURN_OK;
+    }
+
+    if (rows == 0 || isImage(memObj)) {
+        addLog("createRowView", CL_INVALID_MEM_OBJECT, memObj);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+
+    size_t pitch = bufferRowPitch(memObj, cols, size);
+    cl_mem root = NULL;
+    size_t offset = 0;
+    clGetMemObjectInfo(memObj, CL_MEM_ASSOCIATED_MEMOBJECT, sizeof(cl_mem), &root, NULL);
+    if (root != NULL) {
+        clGetMemObjectInfo(memObj, CL_MEM_OFFSET, sizeof(size_t), &offset, NULL);
+    }
+    else {
+        root = memObj;
+    }
+
+    cl_buffer_region region = {offset + startRow*pitch, rows*pitch};
+    cl_mem view = clCreateSubBuffer(root, 0, CL_BUFFER_CREATE_TYPE_REGION, &region, &CL_err);
+    if (CL_err != CL_SUCCESS) {
+        addLog("clCreateSubBuffer", CL_err, memObj);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+    api->returnInt(cframe, (size_t) view);
+    return RETURN_OK;
+}
+
+/*
+ * Copies a rows x cols block from [srcRow][srcCol] of one matrix to
+ * [dstRow][dstCol] of another on the same device, without the host:
+ * clEnqueueCopyBufferRect between buffer matrices (pitches are in
+ * elements) or clEnqueueCopyImage between images. Returns 0, or 1 on
+ * failure
+ */
+INSTRUCTION_DEF copyMatrixRegion(FrameData* cframe) {
+    cl_int CL_err = CL_SUCCESS;
+    cl_command_queue queue = (cl_command_queue) api->getParamInt(cframe, 0);
+    cl_mem src = (cl_mem) api->getParamInt(cframe, 1);
+    size_t srcPitch = api->getParamInt(cframe, 2);
+    cl_mem dst = (cl_mem) api->getParamInt(cframe, 3);
+    size_t dstPitch = api->getParamInt(cframe, 4);
+    size_t size = elementSize(api->getParamInt(cframe, 5), 2);
+    size_t srcRow = api->getParamInt(cframe, 6);
+    size_t srcCol = api->getParamInt(cframe, 7);
+    size_t dstRow = api->getParamInt(cframe, 8);
+    size_t dstCol = api->getParamInt(cframe, 9);
+    size_t rows = api->getParamInt(cframe, 10);
+    size_t cols = api->getParamInt(cframe, 11);
+    uint64_t start = nowNs();
+
+    if (rows == 0 || cols == 0) {
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+
+    HOST_MEM* hostSrc = findHostMem(src);
+    HOST_MEM* hostDst = findHostMem(dst);
+    if (hostSrc != NULL || hostDst != NULL) {
+        if (hostSrc == NULL || hostDst == NULL
+            || srcRow + rows > hostSrc->rows || (srcCol + cols)*size > hostSrc->rowPitch
+            || dstRow + rows > hostDst->rows || (dstCol + cols)*size > hostDst->rowPitch) {
+            addLog("copyMatrixRegion", CL_INVALID_VALUE, dst);
+            api->returnInt(cframe, (size_t) 1);
+            return RETURN_OK;
+        }
+        //the two may be views of the same rows
+        for (size_t r = 0; r < rows; r++) {
+            memmove(hostDst->data + (dstRow + r)*hostDst->rowPitch + dstCol*size, hostSrc->data + (srcRow + r)*hostSrc->rowPitch + srcCol*size, cols*size);
+        }
+        recordProfile("copy", NULL, rows*cols*size, nowNs() - start);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+
+    cl_event event = NULL;
+    uint8_t images = isImage(src);
+    if (images != isImage(dst)) {
+        addLog("copyMatrixRegion", CL_INVALID_MEM_OBJECT, dst);
+        api->returnInt(cframe, (size_t) 1);
+        return RETURN_OK;
+    }
+    if (images) {
+        size_t srcOrigin[3] = {srcCol, srcRow, 0};
+        size_t dstOrigin[3] = {dstCol, dstRow, 0};
+        size_t region[3] = {cols, rows, 1};
+        CL_err = clEnqueueCopyImage(queue, src, dst, srcOrigin, dstOrigin, region, 0, NULL, &event);
+    }
+    else {
+        size_t srcOrigin[3] = {srcCol*size, srcRow, 0};
+        size_t dstOrigin[3] = {dstCol*size, dstRow, 0};
+        size_t region[3] = {cols*size, rows, 1};
+        CL_err = clEnqueueCopyBufferRect(queue, src, dst, srcOrigin, dstOrigin, region, srcPitch*size, 0, dstPitch*size, 0, 0, NULL, &event);
+    }
+    if (CL_err == CL_SUCCESS) {
+        CL_err = clWaitForEvents(1, &event);
+    }
+    if (CL_err != CL_SUCCESS) {
+        addLog(images ? "clEnqueueCopyImage" : "clEnqueueCopyBufferRect", CL_err, dst);
+        if (event != NULL) {
+            clReleaseEvent(event);
+        }
+        api->returnInt(cframe, (size_t) 1);
+        return RETURN_OK;
+    }
+    recordProfile("copy", event, rows*cols*size, 0);
+    clReleaseEvent(event);
+    api->returnInt(cframe, (size_t) 0);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeIntMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2; //only supporting 2d matricies
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+    size_t type = api->getParamInt(cframe, 3);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostMatrix, dims, 2, elementSize(type, 2), marshalTypedIntMatrix, type));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF readIntMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* matrixDims = api->getParamEl(cframe, 2);
+    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+    size_t type = api->getParamInt(cframe, 3);
+
+    api->returnEl(cframe, transferOut(queue, memObj, hostMatrixLens, 2, elementSize(type, 2), unmarshalTypedIntMatrix, type));
+    return RETURN_OK;    
 }
 
 INSTRUCTION_DEF writeFloatMatrix(FrameData* cframe) {
     size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2; //only supporting 2d matricies
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostMatrix, dims, 2, sizeof(float), marshalFloatMatrix, FLOAT));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF readFloatMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* matrixDims = api->getParamEl(cframe, 2);
+    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+
+    api->returnEl(cframe, transferOut(queue, memObj, hostMatrixLens, 2, sizeof(float), unmarshalFloatMatrix, FLOAT));
+    return RETURN_OK;    
+}
+
+INSTRUCTION_DEF writeDoubleMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostMatrix, dims, 2, sizeof(double), marshalDoubleMatrix, DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF readDoubleMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* matrixDims = api->getParamEl(cframe, 2);
+    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+
+    api->returnEl(cframe, transferOut(queue, memObj, hostMatrixLens, 2, sizeof(double), unmarshalDoubleMatrix, DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeHalfMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+
+    api->returnInt(cframe, (size_t) transferIn(queue, memObj, hostMatrix, dims, 2, sizeof(uint16_t), marshalHalfMatrix, HALF));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF readHalfMatrix(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 1);
+    cl_mem memObj = (cl_mem) rawParam;
+
+    DanaEl* matrixDims = api->getParamEl(cframe, 2);
+    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+
+    api->returnEl(cframe, transferOut(queue, memObj, hostMatrixLens, 2, sizeof(uint16_t), unmarshalHalfMatrix, HALF));
+    return RETURN_OK;
+}
+
+/*
+ * Non-blocking transfers and kernel launches return a DANA_EVENT
+ * handle wrapping the cl_event of the enqueued command. The host
+ * staging buffer of a transfer must outlive the command, so it is
+ * owned by the event: a write's buffer is freed once the event is
+ * waited on or destroyed, a read's buffer holds the result until it
+ * is collected
+ */
+#define EVENT_KERNEL 0
+#define EVENT_WRITE 1
+#define EVENT_READ 2
+
+typedef struct _dana_event {
+    cl_event event;
+    uint8_t kind;
+    size_t type;
+    size_t lens[2];
+    size_t lenCount;
+    void* hostBuffer;
+    //operation it is profiled under once complete, NULL if it isn't
+    char* profileName;
+    uint64_t profileBytes;
+    uint64_t profileHostNs;
+} DANA_EVENT;
+
+DANA_EVENT* newEvent(uint8_t kind, cl_event event, void* hostBuffer) {
+    DANA_EVENT* ev = (DANA_EVENT*) malloc(sizeof(DANA_EVENT));
+    ev->event = event;
+    ev->kind = kind;
+    ev->type = 0;
+    ev->lens[0] = 0;
+    ev->lens[1] = 0;
+    ev->lenCount = 0;
+    ev->hostBuffer = hostBuffer;
+    ev->profileName = NULL;
+    ev->profileBytes = 0;
+    ev->profileHostNs = 0;
+    return ev;
+}
+
+void profileEventAs(DANA_EVENT* ev, const char* name, uint64_t bytes, uint64_t hostNs) {
+    if (profilingOn && ev != NULL) {
+        ev->profileName = strdup(name);
+        ev->profileBytes = bytes;
+        ev->profileHostNs = hostNs;
+    }
+}
+
+//records the event's command the first time it is seen to have completed
+void recordEventProfile(DANA_EVENT* ev) {
+    if (ev->profileName != NULL) {
+        recordProfile(ev->profileName, ev->event, ev->profileBytes, ev->profileHostNs);
+        free(ev->profileName);
+        ev->profileName = NULL;
+    }
+}
+
+/*
+ * Converts a dana array of DANA_EVENT handles into a cl_event wait list.
+ * Returns NULL (and sets count to 0) for an empty list. Events of host
+ * device commands have nothing to wait for and are left out
+ */
+cl_event* getWaitList(DanaEl* waitEvents, cl_uint* count) {
+    *count = 0;
+    if (waitEvents == NULL) {
+        return NULL;
+    }
+    size_t len = api->getArrayLength(waitEvents);
+    if (len == 0) {
+        return NULL;
+    }
+    cl_event* waitList = (cl_event*) malloc(sizeof(cl_event)*len);
+    for (int i = 0; i < len; i++) {
+        DANA_EVENT* ev = (DANA_EVENT*) api->getArrayCellInt(waitEvents, i);
+        if (ev->event == NULL) {
+            continue;
+        }
+        waitList[*count] = ev->event;
+        (*count)++;
+    }
+    return waitList;
+}
+
+/*
+ * Enqueues the write of a host staging buffer and returns an event
+ * that owns it. On failure the buffer is freed and 0 is returned
+ */
+DANA_EVENT* writeAsync(FrameData* cframe, size_t* lens, size_t lenCount, size_t elementSize, void* host) {
+    cl_command_queue queue = (cl_command_queue) api->getParamInt(cframe, 0);
+    cl_mem memObj = (cl_mem) api->getParamInt(cframe, 1);
+    cl_uint numWait = 0;
+    cl_event* waitList = getWaitList(api->getParamEl(cframe, 3), &numWait);
+
+    cl_event event;
+    cl_int CL_err = enqueueWrite(queue, memObj, CL_FALSE, lens, lenCount, elementSize, host, numWait, waitList, &event);
+    free(waitList);
+    if (CL_err != CL_SUCCESS) {
+        addLog(writeCall(memObj, lenCount), CL_err, memObj);
+        free(host);
+        return NULL;
+    }
+    if (!isHostQueue(queue)) {
+        clFlush(queue);
+    }
+    markBusy(memObj, event);
+    DANA_EVENT* ev = newEvent(EVENT_WRITE, event, host);
+    profileEventAs(ev, "write", regionBytes(lens, lenCount, elementSize), stagingNs);
+    return ev;
+}
+
+INSTRUCTION_DEF writeIntArrayAsync(FrameData* cframe) {
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+    size_t type = api->getParamInt(cframe, 4);
+    void* raw = marshalToStaging(marshalTypedIntArray, hostArray, &hostArrayLen, 1, elementSize(type, 1), type);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, &hostArrayLen, 1, elementSize(type, 1), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeFloatArrayAsync(FrameData* cframe) {
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+    void* raw = marshalToStaging(marshalFloatArray, hostArray, &hostArrayLen, 1, sizeof(float), FLOAT);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, &hostArrayLen, 1, sizeof(float), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeIntMatrixAsync(FrameData* cframe) {
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+    size_t type = api->getParamInt(cframe, 4);
+    void* raw = marshalToStaging(marshalTypedIntMatrix, hostMatrix, dims, 2, elementSize(type, 2), type);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, dims, 2, elementSize(type, 2), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeFloatMatrixAsync(FrameData* cframe) {
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+    void* raw = marshalToStaging(marshalFloatMatrix, hostMatrix, dims, 2, sizeof(float), FLOAT);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, dims, 2, sizeof(float), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeDoubleArrayAsync(FrameData* cframe) {
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+    void* raw = marshalToStaging(marshalDoubleArray, hostArray, &hostArrayLen, 1, sizeof(double), DOUBLE);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, &hostArrayLen, 1, sizeof(double), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeDoubleMatrixAsync(FrameData* cframe) {
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+    void* raw = marshalToStaging(marshalDoubleMatrix, hostMatrix, dims, 2, sizeof(double), DOUBLE);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, dims, 2, sizeof(double), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeHalfArrayAsync(FrameData* cframe) {
+    DanaEl* hostArray = api->getParamEl(cframe, 2);
+    size_t hostArrayLen = api->getArrayLength(hostArray);
+    void* raw = marshalToStaging(marshalHalfArray, hostArray, &hostArrayLen, 1, sizeof(uint16_t), HALF);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, &hostArrayLen, 1, sizeof(uint16_t), raw));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeHalfMatrixAsync(FrameData* cframe) {
+    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
+    size_t dim = 2;
+    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+    void* raw = marshalToStaging(marshalHalfMatrix, hostMatrix, dims, 2, sizeof(uint16_t), HALF);
+    api->returnInt(cframe, (size_t) writeAsync(cframe, dims, 2, sizeof(uint16_t), raw));
+    return RETURN_OK;
+}
+
+/*
+ * Input: queue, memory object, lengths of each dimension (one for
+ * an array, {rows, cols} for a matrix), element type, events to wait for
+ * Enqueues a non-blocking read into a staging buffer owned by the
+ * returned event; the result is fetched with the collect functions
+ */
+INSTRUCTION_DEF readAsync(FrameData* cframe) {
+    cl_command_queue queue = (cl_command_queue) api->getParamInt(cframe, 0);
+    cl_mem memObj = (cl_mem) api->getParamInt(cframe, 1);
+    DanaEl* rawLens = api->getParamEl(cframe, 2);
+    size_t type = api->getParamInt(cframe, 3);
+
+    DANA_EVENT* ev = newEvent(EVENT_READ, NULL, NULL);
+    ev->type = type;
+    ev->lenCount = api->getArrayLength(rawLens) == 2 ? 2 : 1;
+    ev->lens[0] = api->getArrayCellInt(rawLens, 0);
+    ev->lens[1] = ev->lenCount == 2 ? api->getArrayCellInt(rawLens, 1) : 1;
+
+    size_t size = elementSize(type, ev->lenCount);
+    ev->hostBuffer = malloc(size*ev->lens[0]*ev->lens[1]);
+
+    cl_uint numWait = 0;
+    cl_event* waitList = getWaitList(api->getParamEl(cframe, 4), &numWait);
+    cl_int CL_err = enqueueRead(queue, memObj, CL_FALSE, ev->lens, ev->lenCount, size, ev->hostBuffer, numWait, waitList, &ev->event);
+    free(waitList);
+    if (CL_err != CL_SUCCESS) {
+        addLog(readCall(memObj, ev->lenCount), CL_err, memObj);
+        free(ev->hostBuffer);
+        free(ev);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+    if (!isHostQueue(queue)) {
+        clFlush(queue);
+    }
+    markBusy(memObj, ev->event);
+    profileEventAs(ev, "read", regionBytes(ev->lens, ev->lenCount, size), 0);
+
+    api->returnInt(cframe, (size_t) ev);
+    return RETURN_OK;
+}
+
+/*
+ * Blocks until the event's command has completed. Returns 0 if it
+ * completed successfully, 1 otherwise. A write's staging buffer is
+ * no longer needed once this returns
+ */
+int completeEvent(DANA_EVENT* ev) {
+    cl_int CL_err = ev->event == NULL ? CL_SUCCESS : clWaitForEvents(1, &ev->event);
+    if (CL_err == CL_SUCCESS) {
+        recordEventProfile(ev);
+    }
+    if (ev->kind == EVENT_WRITE) {
+        free(ev->hostBuffer);
+        ev->hostBuffer = NULL;
+    }
+    if (CL_err != CL_SUCCESS) {
+        addLog("clWaitForEvents", CL_err, ev);
+        return 1;
+    }
+    return 0;
+}
+
+INSTRUCTION_DEF waitEvent(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    api->returnInt(cframe, (size_t) completeEvent(ev));
+    return RETURN_OK;
+}
+
+/*
+ * Returns 0 while the command is queued or running, 1 once
+ * it has completed and 2 if it terminated with an error
+ */
+INSTRUCTION_DEF getEventStatus(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    cl_int status = CL_QUEUED;
+    //a host device command completed before its event was made
+    if (ev->event == NULL) {
+        api->returnInt(cframe, (size_t) 1);
+        return RETURN_OK;
+    }
+    cl_int CL_err = clGetEventInfo(ev->event, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(cl_int), &status, NULL);
+    if (CL_err != CL_SUCCESS) {
+        addLog("clGetEventInfo", CL_err, ev);
+        api->returnInt(cframe, (size_t) 2);
+        return RETURN_OK;
+    }
+    if (status < 0) {
+        api->returnInt(cframe, (size_t) 2);
+    }
+    else if (status == CL_COMPLETE) {
+        api->returnInt(cframe, (size_t) 1);
+    }
+    else {
+        api->returnInt(cframe, (size_t) 0);
+    }
+    return RETURN_OK;
+}
+
+/*
+ * Waits for a read event and returns its staging buffer, or NULL
+ * if the event isn't a completed read of the given type and shape
+ */
+void* collectRead(DANA_EVENT* ev, size_t type, size_t lenCount) {
+    if (ev->kind != EVENT_READ || ev->type != type || ev->lenCount != lenCount || ev->hostBuffer == NULL) {
+        addLog("collect", CL_INVALID_EVENT, ev);
+        return NULL;
+    }
+    if (completeEvent(ev) != 0) {
+        return NULL;
+    }
+    return ev->hostBuffer;
+}
+
+INSTRUCTION_DEF collectIntArray(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    size_t type = isIntType(ev->type) ? ev->type : UINT;
+    void* raw = collectRead(ev, type, 1);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalTypedIntArray(raw, ev->lens, elementSize(type, 1)*ev->lens[0], type));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectFloatArray(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    float* raw = (float*) collectRead(ev, FLOAT, 1);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalFloatArray(raw, ev->lens, sizeof(float)*ev->lens[0], FLOAT));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectIntMatrix(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    size_t type = isIntType(ev->type) ? ev->type : UINT;
+    void* raw = collectRead(ev, type, 2);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalTypedIntMatrix(raw, ev->lens, elementSize(type, 2)*ev->lens[1], type));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectFloatMatrix(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    float* raw = (float*) collectRead(ev, FLOAT, 2);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalFloatMatrix(raw, ev->lens, sizeof(float)*ev->lens[1], FLOAT));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectDoubleArray(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    double* raw = (double*) collectRead(ev, DOUBLE, 1);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalDoubleArray(raw, ev->lens, sizeof(double)*ev->lens[0], DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectDoubleMatrix(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    double* raw = (double*) collectRead(ev, DOUBLE, 2);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalDoubleMatrix(raw, ev->lens, sizeof(double)*ev->lens[1], DOUBLE));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectHalfArray(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    uint16_t* raw = (uint16_t*) collectRead(ev, HALF, 1);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalHalfArray(raw, ev->lens, sizeof(uint16_t)*ev->lens[0], HALF));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectHalfMatrix(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    uint16_t* raw = (uint16_t*) collectRead(ev, HALF, 2);
+    api->returnEl(cframe, raw == NULL ? NULL : unmarshalHalfMatrix(raw, ev->lens, sizeof(uint16_t)*ev->lens[1], HALF));
+    return RETURN_OK;
+}
+
+/*
+ * Streaming a host array through a smaller memory object a chunk at a
+ * time. A chunk is a run of cells of the host array, matrices taken as
+ * their cells in row order, so it is marshalled straight from (and
+ * unmarshalled straight into) the dana content at its offset rather
+ * than being copied out to an array of its own first
+ */
+uint8_t bulkOpFor(size_t type, uint8_t toRaw) {
+    switch (type) {
+        case FLOAT: return toRaw ? BULK_DEC_TO_FLOAT : BULK_FLOAT_TO_DEC;
+        case DOUBLE: return toRaw ? BULK_DEC_TO_DOUBLE : BULK_DOUBLE_TO_DEC;
+        case HALF: return toRaw ? BULK_DEC_TO_HALF : BULK_HALF_TO_DEC;
+        case UINT: return toRaw ? BULK_INT_TO_SIZE_T : BULK_SIZE_T_TO_INT;
+        default: return toRaw ? BULK_INT_TO_TYPED : BULK_TYPED_TO_INT;
+    }
+}
+
+uint8_t isDecType(size_t type) {
+    return type == FLOAT || type == DOUBLE || type == HALF;
+}
+
+void* marshalRangeToStaging(DanaEl* host, size_t start, size_t count, size_t type) {
+    uint64_t begin = nowNs();
+    size_t size = elementSize(type, 1);
+    void* staging = malloc(size*count);
+    if (isDecType(type) ? bulkDec() : bulkInt()) {
+        uint8_t op = bulkOpFor(type, 1);
+        runBulkTyped(op, type, api->getArrayContent(host) + start*bulkCellSize(op), staging, 1, count, size*count);
+    }
+    else {
+        for (size_t i = 0; i < count; i++) {
+            switch (type) {
+                case FLOAT: ((float*) staging)[i] = api->getArrayCellDec(host, start + i); break;
+                case DOUBLE: ((double*) staging)[i] = api->getArrayCellDec(host, start + i); break;
+                case HALF: ((uint16_t*) staging)[i] = floatToHalf((float) api->getArrayCellDec(host, start + i)); break;
+                default: storeTypedInt(staging, i, type == UINT ? UINT64 : type, api->getArrayCellInt(host, start + i));
+            }
+        }
+    }
+    stagingNs = nowNs() - begin;
+    return staging;
+}
+
+void unmarshalRange(void* raw, DanaEl* host, size_t start, size_t count, size_t type) {
+    size_t size = elementSize(type, 1);
+    if (isDecType(type) ? bulkDec() : bulkInt()) {
+        uint8_t op = bulkOpFor(type, 0);
+        runBulkTyped(op, type, api->getArrayContent(host) + start*bulkCellSize(op), raw, 1, count, size*count);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        switch (type) {
+            case FLOAT: api->setArrayCellDec(host, start + i, ((float*) raw)[i]); break;
+            case DOUBLE: api->setArrayCellDec(host, start + i, ((double*) raw)[i]); break;
+            case HALF: api->setArrayCellDec(host, start + i, halfToFloat(((uint16_t*) raw)[i])); break;
+            default: api->setArrayCellInt(host, start + i, loadTypedInt(raw, i, type == UINT ? UINT64 : type));
+        }
+    }
+}
+
+size_t cellCount(DanaEl* host) {
+    size_t dimCount = 0;
+    size_t* dims = api->getArrayDimensions(host, &dimCount);
+    size_t cells = 1;
+    for (size_t i = 0; i < dimCount; i++) {
+        cells *= dims[i];
+    }
+    return cells;
+}
+
+/*
+ * Input: queue, memory object, host array, events to wait for, element
+ * type, first cell, number of cells
+ * As the write*ArrayAsync functions, but writes 'count' cells of the
+ * host array from cell 'start' to the start of the memory object
+ */
+DANA_EVENT* writeRangeAsync(FrameData* cframe) {
+    DanaEl* host = api->getParamEl(cframe, 2);
+    size_t type = api->getParamInt(cframe, 4);
+    size_t start = api->getParamInt(cframe, 5);
+    size_t count = api->getParamInt(cframe, 6);
+    size_t cells = cellCount(host);
+    if (count == 0 || start > cells || count > cells - start) {
+        addLog("writeRangeAsync", CL_INVALID_VALUE, host);
+        return NULL;
+    }
+    void* raw = marshalRangeToStaging(host, start, count, type);
+    return writeAsync(cframe, &count, 1, elementSize(type, 1), raw);
+}
+
+INSTRUCTION_DEF writeIntRangeAsync(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) writeRangeAsync(cframe));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeDecRangeAsync(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) writeRangeAsync(cframe));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF writeDecRowsAsync(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) writeRangeAsync(cframe));
+    return RETURN_OK;
+}
+
+/*
+ * Input: read event of an array, host array, first cell
+ * As the collect functions, but copies the cells read into the host
+ * array from cell 'start' rather than returning a new array, stopping
+ * at the end of the host array. Returns 0 on success, 1 otherwise
+ */
+size_t collectRange(FrameData* cframe, uint8_t isDec) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    DanaEl* host = api->getParamEl(cframe, 1);
+    size_t start = api->getParamInt(cframe, 2);
+    if (isDecType(ev->type) != isDec) {
+        addLog("collect", CL_INVALID_EVENT, ev);
+        return 1;
+    }
+    void* raw = collectRead(ev, ev->type, 1);
+    if (raw == NULL) {
+        return 1;
+    }
+    size_t cells = api->getArrayLength(host);
+    size_t count = start < cells ? cells - start : 0;
+    if (count > ev->lens[0]) {
+        count = ev->lens[0];
+    }
+    unmarshalRange(raw, host, start, count, ev->type);
+    return 0;
+}
+
+INSTRUCTION_DEF collectIntInto(FrameData* cframe) {
+    api->returnInt(cframe, collectRange(cframe, 0));
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF collectDecInto(FrameData* cframe) {
+    api->returnInt(cframe, collectRange(cframe, 1));
+    return RETURN_OK;
+}
+
+/*
+ * Releases an event. The command is waited on first, since its
+ * staging buffer can't be freed while opencl may still use it
+ */
+INSTRUCTION_DEF destroyEvent(FrameData* cframe) {
+    DANA_EVENT* ev = (DANA_EVENT*) api->getParamInt(cframe, 0);
+    if (ev == NULL) {
+        return RETURN_OK;
+    }
+    if (ev->event == NULL || clWaitForEvents(1, &ev->event) == CL_SUCCESS) {
+        recordEventProfile(ev);
+    }
+    if (ev->event != NULL) {
+        clReleaseEvent(ev->event);
+    }
+    free(ev->hostBuffer);
+    free(ev->profileName);
+    free(ev);
+    return RETURN_OK;
+}
+
+/*
+ * Hands the memory object back to the pool of the DANA_COMP it
+ * was created under; it is only released to the driver if the
+ * pool is full
+ */
+INSTRUCTION_DEF destroyMemoryArea(FrameData* cframe) {
+    cl_int CL_err = CL_SUCCESS;
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_mem memObj = (cl_mem) rawParam; 
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 1);
+    if (freeHostMem(memObj)) {
+        return RETURN_OK;
+    }
+    //the next line seg faults if memObj has already been released...
+    //averting this has been attemted in dana, but I'll leave this note
+    //here just in case
+    CL_err = poolRelease(danaComp, memObj);
+    if (CL_err != CL_SUCCESS) {
+        addLog("clReleaseMemObject", CL_err, memObj);
+        return RETURN_OK;
+    }
+    return RETURN_OK;
+}
+
+/*
+ * Returns [hits, misses, bytes retained, objects retained]
+ * for the pool belonging to the given DANA_COMP
+ */
+INSTRUCTION_DEF getPoolStats(FrameData* cframe) {
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 0);
+
+    DanaEl* returnArray = api->makeArray(intArrayGT, 4, NULL);
+    pthread_mutex_lock(&danaComp->poolLock);
+    api->setArrayCellInt(returnArray, 0, danaComp->poolHits);
+    api->setArrayCellInt(returnArray, 1, danaComp->poolMisses);
+    api->setArrayCellInt(returnArray, 2, danaComp->poolBytesRetained);
+    api->setArrayCellInt(returnArray, 3, danaComp->poolObjectsRetained);
+    pthread_mutex_unlock(&danaComp->poolLock);
+
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF trimPool(FrameData* cframe) {
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 0);
+    poolTrim(danaComp, 0);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF setPoolLimit(FrameData* cframe) {
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 0);
+    size_t limit = api->getParamInt(cframe, 1);
+    pthread_mutex_lock(&danaComp->poolLock);
+    danaComp->poolLimit = limit;
+    pthread_mutex_unlock(&danaComp->poolLock);
+    //evicts only down to the new limit, keeping what still fits
+    poolTrim(danaComp, limit);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF destroyContextSpace(FrameData* cframe) {
+    size_t rawParam = api->getParamInt(cframe, 0);
+    DANA_COMP* comp = (DANA_COMP*) rawParam;
+    destroyContexts(comp);
+    return RETURN_OK;
+}
+
+/*
+ * Host kernels run on a pool of worker threads, started by the first
+ * launch big enough to split. A launch hands the pool a function and
+ * a range of items (cells, rows or work-groups), which the workers and
+ * the launching thread take a chunk at a time, and returns once every
+ * chunk has run. Launches are run one at a time
+ */
+//launches with less work than this (items times work per item) run on the calling thread
+#define HOST_SERIAL_WORK (1 << 16)
+#define HOST_CHUNKS_PER_THREAD 4
+
+typedef void (*HOST_RANGE_FN)(void* job, size_t from, size_t to);
+
+pthread_mutex_t hostLaunchLock = PTHREAD_MUTEX_INITIALIZER;
+pthread_mutex_t hostPoolLock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t hostPoolWake = PTHREAD_COND_INITIALIZER;
+pthread_cond_t hostPoolIdle = PTHREAD_COND_INITIALIZER;
+pthread_t hostWorkers[HOST_MAX_THREADS];
+size_t hostWorkerCount = 0;
+uint8_t hostPoolStarted = 0;
+uint8_t hostPoolStopping = 0;
+//the pool is started before the first launch, so workers start having seen generation 0
+uint64_t hostGeneration = 0;
+size_t hostBusy = 0;
+HOST_RANGE_FN hostFn = NULL;
+void* hostJob = NULL;
+size_t hostItems = 0;
+size_t hostChunk = 1;
+size_t hostNext = 0;
+
+//takes chunks of the current launch until none are left, called with hostPoolLock held
+void hostTakeChunks() {
+    while (hostNext < hostItems) {
+        size_t from = hostNext;
+        size_t to = hostItems - from > hostChunk ? from + hostChunk : hostItems;
+        hostNext = to;
+        pthread_mutex_unlock(&hostPoolLock);
+        hostFn(hostJob, from, to);
+        pthread_mutex_lock(&hostPoolLock);
+    }
+}
+
+void* hostWorker(void* arg) {
+    uint64_t seen = 0;
+    pthread_mutex_lock(&hostPoolLock);
+    while (1) {
+        while (hostGeneration == seen && !hostPoolStopping) {
+            pthread_cond_wait(&hostPoolWake, &hostPoolLock);
+        }
+        if (hostPoolStopping) {
+            break;
+        }
+        seen = hostGeneration;
+        hostTakeChunks();
+        hostBusy--;
+        if (hostBusy == 0) {
+            pthread_cond_signal(&hostPoolIdle);
+        }
+    }
+    pthread_mutex_unlock(&hostPoolLock);
+    return NULL;
+}
+
+void startHostPool() {
+    if (hostPoolStarted) {
+        return;
+    }
+    hostPoolStarted = 1;
+    //the launching thread is the last one
+    for (size_t t = 1; t < hostThreads; t++) {
+        if (pthread_create(&hostWorkers[hostWorkerCount], NULL, hostWorker, NULL) != 0) {
+            break;
+        }
+        hostWorkerCount++;
+    }
+}
+
+void stopHostPool() {
+    pthread_mutex_lock(&hostPoolLock);
+    hostPoolStopping = 1;
+    pthread_cond_broadcast(&hostPoolWake);
+    pthread_mutex_unlock(&hostPoolLock);
+    for (size_t t = 0; t < hostWorkerCount; t++) {
+        pthread_join(hostWorkers[t], NULL);
+    }
+    hostWorkerCount = 0;
+}
+
+void runHostRange(HOST_RANGE_FN fn, void* job, size_t items, size_t workPerItem) {
+    if (items < 2 || items*workPerItem < HOST_SERIAL_WORK || hostThreads < 2) {
+        fn(job, 0, items);
+        return;
+    }
+    pthread_mutex_lock(&hostLaunchLock);
+    startHostPool();
+    if (hostWorkerCount == 0) {
+        pthread_mutex_unlock(&hostLaunchLock);
+        fn(job, 0, items);
+        return;
+    }
+    pthread_mutex_lock(&hostPoolLock);
+    size_t chunks = (hostWorkerCount + 1)*HOST_CHUNKS_PER_THREAD;
+    hostFn = fn;
+    hostJob = job;
+    hostItems = items;
+    hostNext = 0;
+    hostChunk = (items + chunks - 1)/chunks;
+    hostBusy = hostWorkerCount;
+    hostGeneration++;
+    pthread_cond_broadcast(&hostPoolWake);
+    hostTakeChunks();
+    while (hostBusy > 0) {
+        pthread_cond_wait(&hostPoolIdle, &hostPoolLock);
+    }
+    pthread_mutex_unlock(&hostPoolLock);
+    pthread_mutex_unlock(&hostLaunchLock);
+}
+
+/*
+ * Cells of host memory as kernels see them. A host kernel reads and
+ * writes each buffer as the type it was created with, where its OpenCL
+ * build would be told the type by -D REAL or -D INT_T, with fast paths
+ * for float and double. Half cells are computed in float or double
+ */
+size_t hostCells(HOST_MEM* mem) {
+    return mem->rowPitch*mem->rows/mem->elementSize;
+}
+
+//true if rows of 'cols' cells, 'pitch' cells apart, fit in mem
+uint8_t hostFits(HOST_MEM* mem, size_t rows, size_t cols, size_t pitch) {
+    return rows == 0 || cols == 0 || ((cols <= pitch || rows == 1) && (rows - 1)*pitch + cols <= hostCells(mem));
+}
+
+uint8_t isRealType(size_t type) {
+    return type == FLOAT || type == DOUBLE || type == HALF;
+}
+
+int64_t hostLoadInt(HOST_MEM* mem, size_t i) {
+    unsigned char* cell = mem->data + i*mem->elementSize;
+    switch (mem->type) {
+        case FLOAT: return (int64_t) *(float*) cell;
+        case DOUBLE: return (int64_t) *(double*) cell;
+        case HALF: return (int64_t) halfToFloat(*(uint16_t*) cell);
+        case INT8: return *(int8_t*) cell;
+        case UINT8: return *(uint8_t*) cell;
+        case INT16: return *(int16_t*) cell;
+        case UINT16: return *(uint16_t*) cell;
+        case INT32: return *(int32_t*) cell;
+        case UINT32: return *(uint32_t*) cell;
+        case UINT: return mem->elementSize == sizeof(uint32_t) ? *(uint32_t*) cell : *(int64_t*) cell;
+        default: return *(int64_t*) cell;
+    }
+}
+
+void hostStoreInt(HOST_MEM* mem, size_t i, int64_t value) {
+    unsigned char* cell = mem->data + i*mem->elementSize;
+    switch (mem->elementSize) {
+        case 1: *(uint8_t*) cell = (uint8_t) value; return;
+        case 2:
+            if (mem->type == HALF) {
+                *(uint16_t*) cell = floatToHalf((float) value);
+                return;
+            }
+            *(uint16_t*) cell = (uint16_t) value;
+            return;
+        case 4:
+            if (mem->type == FLOAT) {
+                *(float*) cell = (float) value;
+                return;
+            }
+            *(uint32_t*) cell = (uint32_t) value;
+            return;
+        default:
+            if (mem->type == DOUBLE) {
+                *(double*) cell = (double) value;
+                return;
+            }
+            *(int64_t*) cell = value;
+            return;
+    }
+}
+
+double hostLoadReal(HOST_MEM* mem, size_t i) {
+    unsigned char* cell = mem->data + i*mem->elementSize;
+    switch (mem->type) {
+        case FLOAT: return *(float*) cell;
+        case DOUBLE: return *(double*) cell;
+        case HALF: return halfToFloat(*(uint16_t*) cell);
+        default: return (double) hostLoadInt(mem, i);
+    }
+}
+
+void hostStoreReal(HOST_MEM* mem, size_t i, double value) {
+    unsigned char* cell = mem->data + i*mem->elementSize;
+    switch (mem->type) {
+        case FLOAT: *(float*) cell = (float) value; return;
+        case DOUBLE: *(double*) cell = value; return;
+        case HALF: *(uint16_t*) cell = floatToHalf((float) value); return;
+        default: hostStoreInt(mem, i, (int64_t) value); return;
+    }
+}
+
+/*
+ * Float and double loops of the hot kernels, with AVX2 where the CPU
+ * has it (see simdPath)
+ */
+#define HOST_OP_ADD 0
+#define HOST_OP_MUL 1
+
+#ifdef HAVE_X86_SIMD
+__attribute__((target("avx2")))
+void hostBinaryFloatAVX2(float* a, float* b, float* c, size_t n, uint8_t op) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(a + i);
+        __m256 y = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(c + i, op == HOST_OP_MUL ? _mm256_mul_ps(x, y) : _mm256_add_ps(x, y));
+    }
+    for (; i < n; i++) {
+        c[i] = op == HOST_OP_MUL ? a[i]*b[i] : a[i] + b[i];
+    }
+}
+
+__attribute__((target("avx2")))
+void hostBinaryDoubleAVX2(double* a, double* b, double* c, size_t n, uint8_t op) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(c + i, op == HOST_OP_MUL ? _mm256_mul_pd(x, y) : _mm256_add_pd(x, y));
+    }
+    for (; i < n; i++) {
+        c[i] = op == HOST_OP_MUL ? a[i]*b[i] : a[i] + b[i];
+    }
+}
+
+//y += s*x
+__attribute__((target("avx2")))
+void hostAxpyFloatAVX2(float s, float* x, float* y, size_t n) {
+    __m256 scale = _mm256_set1_ps(s);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(scale, _mm256_loadu_ps(x + i))));
+    }
+    for (; i < n; i++) {
+        y[i] += s*x[i];
+    }
+}
+
+__attribute__((target("avx2")))
+void hostAxpyDoubleAVX2(double s, double* x, double* y, size_t n) {
+    __m256d scale = _mm256_set1_pd(s);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(scale, _mm256_loadu_pd(x + i))));
+    }
+    for (; i < n; i++) {
+        y[i] += s*x[i];
+    }
+}
+
+__attribute__((target("avx2")))
+float hostDotFloatAVX2(float* a, float* b, size_t n) {
+    __m256 acc = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc);
+    float sum = lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    for (; i < n; i++) {
+        sum += a[i]*b[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2")))
+double hostDotDoubleAVX2(double* a, double* b, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    double sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++) {
+        sum += a[i]*b[i];
+    }
+    return sum;
+}
+#endif
+
+void hostBinaryFloat(float* a, float* b, float* c, size_t n, uint8_t op) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        hostBinaryFloatAVX2(a, b, c, n, op);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        c[i] = op == HOST_OP_MUL ? a[i]*b[i] : a[i] + b[i];
+    }
+}
+
+void hostBinaryDouble(double* a, double* b, double* c, size_t n, uint8_t op) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        hostBinaryDoubleAVX2(a, b, c, n, op);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        c[i] = op == HOST_OP_MUL ? a[i]*b[i] : a[i] + b[i];
+    }
+}
+
+void hostAxpyFloat(float s, float* x, float* y, size_t n) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        hostAxpyFloatAVX2(s, x, y, n);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        y[i] += s*x[i];
+    }
+}
+
+void hostAxpyDouble(double s, double* x, double* y, size_t n) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        hostAxpyDoubleAVX2(s, x, y, n);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < n; i++) {
+        y[i] += s*x[i];
+    }
+}
+
+float hostDotFloat(float* a, float* b, size_t n) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        return hostDotFloatAVX2(a, b, n);
+    }
+#endif
+    float sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += a[i]*b[i];
+    }
+    return sum;
+}
+
+double hostDotDouble(double* a, double* b, size_t n) {
+#ifdef HAVE_X86_SIMD
+    if (simdPath == PATH_AVX2) {
+        return hostDotDoubleAVX2(a, b, n);
+    }
+#endif
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += a[i]*b[i];
+    }
+    return sum;
+}
+
+/*
+ * A launch of a host kernel: its buffers, in parameter order, and
+ * its global and work-group sizes (unused dimensions are 1). Each
+ * kernel checks the launch stays inside its buffers, where an OpenCL
+ * device would read or write past them, and returns a CL error code
+ */
+#define HOST_MAX_ARGS 8
+
+typedef struct _host_launch {
+    HOST_MEM* args[HOST_MAX_ARGS];
+    size_t global[3];
+    size_t local[3];
+    uint8_t op;
+} HOST_LAUNCH;
+
+//the launch's parameter buffer 'arg' as sizes, NULL if it has fewer than count cells
+uint8_t hostParams(HOST_LAUNCH* launch, size_t arg, size_t* params, size_t count) {
+    if (hostCells(launch->args[arg]) < count) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        params[i] = (size_t) hostLoadInt(launch->args[arg], i);
+    }
+    return 1;
+}
+
+//vaddi, vaddd, vcombi, vcombd: C = A + B or A * B
+void hostBinaryRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    HOST_MEM* a = launch->args[0];
+    HOST_MEM* b = launch->args[1];
+    HOST_MEM* c = launch->args[2];
+    if (a->type == FLOAT && b->type == FLOAT && c->type == FLOAT) {
+        hostBinaryFloat((float*) a->data + from, (float*) b->data + from, (float*) c->data + from, to - from, launch->op);
+        return;
+    }
+    if (a->type == DOUBLE && b->type == DOUBLE && c->type == DOUBLE) {
+        hostBinaryDouble((double*) a->data + from, (double*) b->data + from, (double*) c->data + from, to - from, launch->op);
+        return;
+    }
+    for (size_t i = from; i < to; i++) {
+        if (isRealType(c->type)) {
+            double x = hostLoadReal(a, i);
+            double y = hostLoadReal(b, i);
+            hostStoreReal(c, i, launch->op == HOST_OP_MUL ? x*y : x + y);
+        }
+        else {
+            //unsigned, so overflow wraps as it does on the device
+            uint64_t x = (uint64_t) hostLoadInt(a, i);
+            uint64_t y = (uint64_t) hostLoadInt(b, i);
+            hostStoreInt(c, i, (int64_t) (launch->op == HOST_OP_MUL ? x*y : x + y));
+        }
+    }
+}
+
+cl_int runHostBinary(HOST_LAUNCH* launch) {
+    size_t n = launch->global[0];
+    for (int i = 0; i < 3; i++) {
+        if (hostCells(launch->args[i]) < n) {
+            return CL_INVALID_GLOBAL_WORK_SIZE;
+        }
+    }
+    runHostRange(hostBinaryRange, launch, n, 1);
+    return CL_SUCCESS;
+}
+
+//vscalei, vscaled: A = scalar[0] * A
+void hostScaleRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    HOST_MEM* scalar = launch->args[0];
+    HOST_MEM* a = launch->args[1];
+    if (a->type == FLOAT && scalar->type == FLOAT) {
+        float s = *(float*) scalar->data;
+        float* cells = (float*) a->data;
+        for (size_t i = from; i < to; i++) {
+            cells[i] *= s;
+        }
+        return;
+    }
+    if (a->type == DOUBLE && scalar->type == DOUBLE) {
+        double s = *(double*) scalar->data;
+        double* cells = (double*) a->data;
+        for (size_t i = from; i < to; i++) {
+            cells[i] *= s;
+        }
+        return;
+    }
+    if (isRealType(a->type)) {
+        double s = hostLoadReal(scalar, 0);
+        for (size_t i = from; i < to; i++) {
+            hostStoreReal(a, i, s*hostLoadReal(a, i));
+        }
+        return;
+    }
+    uint64_t s = (uint64_t) hostLoadInt(scalar, 0);
+    for (size_t i = from; i < to; i++) {
+        hostStoreInt(a, i, (int64_t) (s*(uint64_t) hostLoadInt(a, i)));
+    }
+}
+
+cl_int runHostScale(HOST_LAUNCH* launch) {
+    if (hostCells(launch->args[0]) < 1 || hostCells(launch->args[1]) < launch->global[0]) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostScaleRange, launch, launch->global[0], 1);
+    return CL_SUCCESS;
+}
+
+//lintransdb, dims = {cols, pitch}: Vt[i] = T[i] . V for each row i of T
+void hostLintransRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[2];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return;
+    }
+    HOST_MEM* t = launch->args[1];
+    HOST_MEM* v = launch->args[2];
+    HOST_MEM* vt = launch->args[3];
+    for (size_t i = from; i < to; i++) {
+        if (t->type == FLOAT && v->type == FLOAT && vt->type == FLOAT) {
+            ((float*) vt->data)[i] = hostDotFloat((float*) t->data + i*dims[1], (float*) v->data, dims[0]);
+        }
+        else if (t->type == DOUBLE && v->type == DOUBLE && vt->type == DOUBLE) {
+            ((double*) vt->data)[i] = hostDotDouble((double*) t->data + i*dims[1], (double*) v->data, dims[0]);
+        }
+        else {
+            double sum = 0;
+            for (size_t k = 0; k < dims[0]; k++) {
+                sum += hostLoadReal(v, k)*hostLoadReal(t, i*dims[1] + k);
+            }
+            hostStoreReal(vt, i, sum);
+        }
+    }
+}
+
+cl_int runHostLintrans(HOST_LAUNCH* launch) {
+    size_t dims[2];
+    size_t rows = launch->global[0];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(launch->args[1], rows, dims[0], dims[1]) || hostCells(launch->args[2]) < dims[0] || hostCells(launch->args[3]) < rows) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostLintransRange, launch, rows, dims[0]);
+    return CL_SUCCESS;
+}
+
+/*
+ * mattransdb, dims = {pitch of M, pitch of Mt}: Mt[r][c] = M[c][r]
+ * over the global size {rows, cols} of Mt, a block of rows at a time
+ * so the columns read from M stay in cache
+ */
+#define HOST_TRANSPOSE_BLOCK 32
+
+void hostTransposeRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[2];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return;
+    }
+    HOST_MEM* m = launch->args[1];
+    HOST_MEM* mt = launch->args[2];
+    size_t rows = launch->global[0];
+    size_t cols = launch->global[1];
+    for (size_t block = from; block < to; block++) {
+        size_t rowEnd = (block + 1)*HOST_TRANSPOSE_BLOCK < rows ? (block + 1)*HOST_TRANSPOSE_BLOCK : rows;
+        for (size_t c0 = 0; c0 < cols; c0 += HOST_TRANSPOSE_BLOCK) {
+            size_t colEnd = c0 + HOST_TRANSPOSE_BLOCK < cols ? c0 + HOST_TRANSPOSE_BLOCK : cols;
+            for (size_t r = block*HOST_TRANSPOSE_BLOCK; r < rowEnd; r++) {
+                for (size_t c = c0; c < colEnd; c++) {
+                    if (m->type == mt->type) {
+                        memcpy(mt->data + (r*dims[1] + c)*mt->elementSize, m->data + (c*dims[0] + r)*m->elementSize, m->elementSize);
+                    }
+                    else {
+                        hostStoreReal(mt, r*dims[1] + c, hostLoadReal(m, c*dims[0] + r));
+                    }
+                }
+            }
+        }
+    }
+}
+
+cl_int runHostTranspose(HOST_LAUNCH* launch) {
+    size_t dims[2];
+    size_t rows = launch->global[0];
+    size_t cols = launch->global[1];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(launch->args[1], cols, rows, dims[0]) || !hostFits(launch->args[2], rows, cols, dims[1])) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostTransposeRange, launch, (rows + HOST_TRANSPOSE_BLOCK - 1)/HOST_TRANSPOSE_BLOCK, HOST_TRANSPOSE_BLOCK*cols);
+    return CL_SUCCESS;
+}
+
+/*
+ * gemm_tiled, gemm_blocked, dims = {M, N, K, lda, ldb, ldc}: C = A * B,
+ * whatever tile sizes the program was built with. Each row of C is
+ * built up a panel of columns at a time as a sum of rows of B scaled
+ * by the row of A, so the panel of B is reused from cache across the
+ * rows a thread takes
+ */
+#define HOST_GEMM_PANEL 256
+
+void hostGemmRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[6];
+    if (!hostParams(launch, 0, dims, 6)) {
+        return;
+    }
+    size_t N = dims[1];
+    size_t K = dims[2];
+    HOST_MEM* a = launch->args[1];
+    HOST_MEM* b = launch->args[2];
+    HOST_MEM* c = launch->args[3];
+    if (a->type == FLOAT && b->type == FLOAT && c->type == FLOAT) {
+        for (size_t j = 0; j < N; j += HOST_GEMM_PANEL) {
+            size_t width = N - j < HOST_GEMM_PANEL ? N - j : HOST_GEMM_PANEL;
+            for (size_t i = from; i < to; i++) {
+                float* row = (float*) c->data + i*dims[5] + j;
+                memset(row, 0, width*sizeof(float));
+                for (size_t k = 0; k < K; k++) {
+                    hostAxpyFloat(((float*) a->data)[i*dims[3] + k], (float*) b->data + k*dims[4] + j, row, width);
+                }
+            }
+        }
+        return;
+    }
+    if (a->type == DOUBLE && b->type == DOUBLE && c->type == DOUBLE) {
+        for (size_t j = 0; j < N; j += HOST_GEMM_PANEL) {
+            size_t width = N - j < HOST_GEMM_PANEL ? N - j : HOST_GEMM_PANEL;
+            for (size_t i = from; i < to; i++) {
+                double* row = (double*) c->data + i*dims[5] + j;
+                memset(row, 0, width*sizeof(double));
+                for (size_t k = 0; k < K; k++) {
+                    hostAxpyDouble(((double*) a->data)[i*dims[3] + k], (double*) b->data + k*dims[4] + j, row, width);
+                }
+            }
+        }
+        return;
+    }
+    for (size_t i = from; i < to; i++) {
+        for (size_t j = 0; j < N; j++) {
+            double sum = 0;
+            for (size_t k = 0; k < K; k++) {
+                sum += hostLoadReal(a, i*dims[3] + k)*hostLoadReal(b, k*dims[4] + j);
+            }
+            hostStoreReal(c, i*dims[5] + j, sum);
+        }
+    }
+}
+
+cl_int runHostGemm(HOST_LAUNCH* launch) {
+    size_t dims[6];
+    if (!hostParams(launch, 0, dims, 6)) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(launch->args[1], dims[0], dims[2], dims[3]) || !hostFits(launch->args[2], dims[2], dims[1], dims[4]) || !hostFits(launch->args[3], dims[0], dims[1], dims[5])) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    runHostRange(hostGemmRange, launch, dims[0], dims[1]*dims[2]);
+    return CL_SUCCESS;
+}
+
+/*
+ * gemm_batched (dims = {M, N, K, lda, ldb, ldc}, A, B, C), gemv_batched
+ * (dims = {R, C, ldt, ldv, ldo}, T, V, out) and transpose_batched
+ * (dims = {R, C, ldm, ldt}, M, Mt): entry g of the batch for each
+ * work-group g of the launch, each operand a stack of entries down its
+ * rows. A thread takes whole entries
+ */
+#define HOST_BATCH_GEMM 0
+#define HOST_BATCH_GEMV 1
+#define HOST_BATCH_TRANSPOSE 2
+
+size_t hostBatchDims(uint8_t op) {
+    return op == HOST_BATCH_GEMM ? 6 : (op == HOST_BATCH_GEMV ? 5 : 4);
+}
+
+void hostBatchedRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[6];
+    if (!hostParams(launch, 0, dims, hostBatchDims(launch->op))) {
+        return;
+    }
+    HOST_MEM* x = launch->args[1];
+    HOST_MEM* y = launch->args[2];
+    HOST_MEM* out = launch->args[3];
+    for (size_t g = from; g < to; g++) {
+        if (launch->op == HOST_BATCH_GEMM) {
+            size_t a = g*dims[0]*dims[3];
+            size_t b = g*dims[2]*dims[4];
+            size_t c = g*dims[0]*dims[5];
+            for (size_t i = 0; i < dims[0]; i++) {
+                if (x->type == FLOAT && y->type == FLOAT && out->type == FLOAT) {
+                    float* row = (float*) out->data + c + i*dims[5];
+                    memset(row, 0, dims[1]*sizeof(float));
+                    for (size_t k = 0; k < dims[2]; k++) {
+                        hostAxpyFloat(((float*) x->data)[a + i*dims[3] + k], (float*) y->data + b + k*dims[4], row, dims[1]);
+                    }
+                    continue;
+                }
+                if (x->type == DOUBLE && y->type == DOUBLE && out->type == DOUBLE) {
+                    double* row = (double*) out->data + c + i*dims[5];
+                    memset(row, 0, dims[1]*sizeof(double));
+                    for (size_t k = 0; k < dims[2]; k++) {
+                        hostAxpyDouble(((double*) x->data)[a + i*dims[3] + k], (double*) y->data + b + k*dims[4], row, dims[1]);
+                    }
+                    continue;
+                }
+                for (size_t j = 0; j < dims[1]; j++) {
+                    double sum = 0;
+                    for (size_t k = 0; k < dims[2]; k++) {
+                        sum += hostLoadReal(x, a + i*dims[3] + k)*hostLoadReal(y, b + k*dims[4] + j);
+                    }
+                    hostStoreReal(out, c + i*dims[5] + j, sum);
+                }
+            }
+        }
+        else if (launch->op == HOST_BATCH_GEMV) {
+            for (size_t r = 0; r < dims[0]; r++) {
+                double sum = 0;
+                for (size_t k = 0; k < dims[1]; k++) {
+                    sum += hostLoadReal(x, (g*dims[0] + r)*dims[2] + k)*hostLoadReal(y, g*dims[3] + k);
+                }
+                hostStoreReal(out, g*dims[4] + r, sum);
+            }
+        }
+        else {
+            for (size_t i = 0; i < dims[0]; i++) {
+                for (size_t j = 0; j < dims[1]; j++) {
+                    hostStoreReal(y, (g*dims[1] + j)*dims[3] + i, hostLoadReal(x, (g*dims[0] + i)*dims[2] + j));
+                }
+            }
+        }
+    }
+}
+
+cl_int runHostBatched(HOST_LAUNCH* launch) {
+    size_t dims[6];
+    if (!hostParams(launch, 0, dims, hostBatchDims(launch->op))) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    size_t groups = launch->local[0] > 0 ? launch->global[0]/launch->local[0] : launch->global[0];
+    uint8_t fits;
+    if (launch->op == HOST_BATCH_GEMM) {
+        fits = hostFits(launch->args[1], groups*dims[0], dims[2], dims[3]) && hostFits(launch->args[2], groups*dims[2], dims[1], dims[4]) && hostFits(launch->args[3], groups*dims[0], dims[1], dims[5]);
+    }
+    else if (launch->op == HOST_BATCH_GEMV) {
+        fits = hostFits(launch->args[1], groups*dims[0], dims[1], dims[2]) && hostFits(launch->args[2], groups, dims[1], dims[3]) && hostFits(launch->args[3], groups, dims[0], dims[4]);
+    }
+    else {
+        fits = hostFits(launch->args[1], groups*dims[0], dims[1], dims[2]) && hostFits(launch->args[2], groups*dims[1], dims[0], dims[3]);
+    }
+    if (!fits) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostBatchedRange, launch, groups, dims[0]*dims[1]*(launch->op == HOST_BATCH_GEMM ? dims[2] : 1));
+    return CL_SUCCESS;
+}
+
+/*
+ * spmv_scalar, spmv_vector (dims = {count, nnz, coo}) and spmm_scalar,
+ * spmm_vector (dims = {count, nnz, coo, N, ldb, ldc}), params (dims,
+ * list, rows, cols, values, in, out): the rows in list of a CSR (or
+ * sorted COO) matrix times a vector or a buffer matrix. The host has
+ * no lanes to share a row between, so both kernels of each are one
+ * loop over the row's values
+ */
+#define HOST_SPMV 0
+#define HOST_SPMM 1
+
+//the first of row r's values and one past its last
+void hostRowRange(HOST_MEM* rows, size_t r, size_t* dims, size_t* first, size_t* last) {
+    if (dims[2] == 0) {
+        *first = (size_t) hostLoadInt(rows, r);
+        *last = (size_t) hostLoadInt(rows, r + 1);
+        return;
+    }
+    for (int bound = 0; bound < 2; bound++) {
+        size_t lo = 0;
+        size_t hi = dims[1];
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo)/2;
+            if ((size_t) hostLoadInt(rows, mid) < r + bound) {
+                lo = mid + 1;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        *(bound == 0 ? first : last) = lo;
+    }
+}
 
-    DanaEl* hostMatrix = api->getParamEl(cframe, 2);
-    size_t dim = 2; //only supporting 2d matricies
-    size_t* dims = api->getArrayDimensions(hostMatrix, &dim);
+void hostSparseRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[6];
+    if (!hostParams(launch, 0, dims, launch->op == HOST_SPMM ? 6 : 3)) {
+        return;
+    }
+    HOST_MEM* cols = launch->args[3];
+    HOST_MEM* values = launch->args[4];
+    HOST_MEM* in = launch->args[5];
+    HOST_MEM* out = launch->args[6];
+    size_t width = launch->op == HOST_SPMM ? dims[3] : 1;
+    for (size_t i = from; i < to; i++) {
+        size_t r = (size_t) hostLoadInt(launch->args[1], i);
+        size_t first;
+        size_t last;
+        hostRowRange(launch->args[2], r, dims, &first, &last);
+        for (size_t j = 0; j < width; j++) {
+            double sum = 0;
+            for (size_t p = first; p < last; p++) {
+                size_t c = (size_t) hostLoadInt(cols, p);
+                sum += hostLoadReal(values, p)*hostLoadReal(in, launch->op == HOST_SPMM ? c*dims[4] + j : c);
+            }
+            hostStoreReal(out, launch->op == HOST_SPMM ? r*dims[5] + j : r, sum);
+        }
+    }
+}
 
-    float* rawHostMatrix = (float*) malloc(sizeof(float)*dims[0]*dims[1]);
-    float* rawHostMatrixCpy = rawHostMatrix;
-    for (int i = 0; i < dims[0]; i++) {
-        for (int j = 0; j < dims[1]; j++) {
-            *rawHostMatrixCpy = api->getArrayCellDec(hostMatrix, (i*dims[1])+j);
-            rawHostMatrixCpy++;
+cl_int runHostSparse(HOST_LAUNCH* launch) {
+    size_t dims[6];
+    uint8_t isMM = launch->op == HOST_SPMM;
+    if (!hostParams(launch, 0, dims, isMM ? 6 : 3) || hostCells(launch->args[1]) < dims[0]) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    HOST_MEM* rows = launch->args[2];
+    size_t rowCount = dims[2] == 0 ? (hostCells(rows) > 0 ? hostCells(rows) - 1 : 0) : 0;
+    if (hostCells(launch->args[3]) < dims[1] || hostCells(launch->args[4]) < dims[1] || (dims[2] != 0 && hostCells(rows) < dims[1])) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    //every row, offset and column index read has to be inside its buffer
+    size_t outRows = isMM ? hostCells(launch->args[6])/(dims[5] > 0 ? dims[5] : 1) : hostCells(launch->args[6]);
+    size_t inRows = isMM ? hostCells(launch->args[5])/(dims[4] > 0 ? dims[4] : 1) : hostCells(launch->args[5]);
+    for (size_t i = 0; i < dims[0]; i++) {
+        size_t r = (size_t) hostLoadInt(launch->args[1], i);
+        if (r >= outRows || (dims[2] == 0 && r >= rowCount)) {
+            return CL_INVALID_KERNEL_ARGS;
+        }
+        if (dims[2] == 0 && (hostLoadInt(rows, r) > hostLoadInt(rows, r + 1) || (size_t) hostLoadInt(rows, r + 1) > dims[1])) {
+            return CL_INVALID_KERNEL_ARGS;
         }
     }
+    for (size_t p = 0; p < dims[1]; p++) {
+        if ((size_t) hostLoadInt(launch->args[3], p) >= inRows) {
+            return CL_INVALID_KERNEL_ARGS;
+        }
+    }
+    if (isMM && (dims[3] > dims[4] || dims[3] > dims[5])) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    runHostRange(hostSparseRange, launch, dims[0], (dims[1]/(dims[0] > 0 ? dims[0] : 1) + 1)*(isMM ? dims[3] : 1));
+    return CL_SUCCESS;
+}
 
-    size_t origin[] = {0, 0, 0};
-    size_t region[] = {dims[1], dims[0], 1};
-    cl_int CL_err = clEnqueueWriteImage(queue, memObj, CL_TRUE, origin, region, 0, 0, rawHostMatrix, 0, NULL, NULL);
+/*
+ * chopColumnFB, chopColumnIB, chopRowFB, chopRowIB, startEnd = {start,
+ * end, pitch in, pitch out}: out is in without the columns (or rows)
+ * [start, end), over the global size {rows, cols} of out
+ */
+#define HOST_CHOP_COLUMN 0
+#define HOST_CHOP_ROW 1
 
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueWriteImage", CL_err));
-        api->returnInt(cframe, (size_t) 1);
-        return RETURN_OK;
+void hostChopRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t startEnd[4];
+    if (!hostParams(launch, 0, startEnd, 4)) {
+        return;
+    }
+    HOST_MEM* in = launch->args[1];
+    HOST_MEM* out = launch->args[2];
+    size_t cols = launch->global[1];
+    size_t cut = startEnd[1] - startEnd[0];
+    for (size_t row = from; row < to; row++) {
+        size_t fromRow = launch->op == HOST_CHOP_ROW && row >= startEnd[0] ? row + cut : row;
+        if (in->type != out->type) {
+            for (size_t col = 0; col < cols; col++) {
+                size_t fromCol = launch->op == HOST_CHOP_COLUMN && col >= startEnd[0] ? col + cut : col;
+                hostStoreReal(out, row*startEnd[3] + col, hostLoadReal(in, fromRow*startEnd[2] + fromCol));
+            }
+            continue;
+        }
+        unsigned char* src = in->data + fromRow*startEnd[2]*in->elementSize;
+        unsigned char* dst = out->data + row*startEnd[3]*out->elementSize;
+        if (launch->op == HOST_CHOP_ROW || startEnd[0] >= cols) {
+            memcpy(dst, src, cols*out->elementSize);
+            continue;
+        }
+        //the columns before the cut, then those after it
+        memcpy(dst, src, startEnd[0]*out->elementSize);
+        memcpy(dst + startEnd[0]*out->elementSize, src + startEnd[1]*in->elementSize, (cols - startEnd[0])*out->elementSize);
     }
-    api->returnInt(cframe, (size_t) 0);
-    free(rawHostMatrix);
-    return RETURN_OK;    
 }
 
-INSTRUCTION_DEF readFloatMatrix(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    rawParam = api->getParamInt(cframe, 1);
-    cl_mem memObj = (cl_mem) rawParam;
+cl_int runHostChop(HOST_LAUNCH* launch) {
+    size_t startEnd[4];
+    size_t rows = launch->global[0];
+    size_t cols = launch->global[1];
+    if (!hostParams(launch, 0, startEnd, 4) || startEnd[1] < startEnd[0]) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    size_t cut = startEnd[1] - startEnd[0];
+    size_t inRows = launch->op == HOST_CHOP_ROW ? rows + cut : rows;
+    size_t inCols = launch->op == HOST_CHOP_COLUMN ? cols + cut : cols;
+    if (!hostFits(launch->args[1], inRows, inCols, startEnd[2]) || !hostFits(launch->args[2], rows, cols, startEnd[3])) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostChopRange, launch, rows, cols);
+    return CL_SUCCESS;
+}
 
-    DanaEl* matrixDims = api->getParamEl(cframe, 2);
-    size_t dim = 2;
-    size_t hostMatrixLens[] = {api->getArrayCellInt(matrixDims, 0), api->getArrayCellInt(matrixDims, 1)};
+//floatDivB, dims = {pitch in, pitch out}: out = matrix / divider[0]
+void hostDivideRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[2];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return;
+    }
+    HOST_MEM* divider = launch->args[1];
+    HOST_MEM* in = launch->args[2];
+    HOST_MEM* out = launch->args[3];
+    size_t cols = launch->global[1];
+    for (size_t row = from; row < to; row++) {
+        if (in->type == FLOAT && out->type == FLOAT && divider->type == FLOAT) {
+            float d = *(float*) divider->data;
+            float* src = (float*) in->data + row*dims[0];
+            float* dst = (float*) out->data + row*dims[1];
+            for (size_t col = 0; col < cols; col++) {
+                dst[col] = src[col] / d;
+            }
+        }
+        else if (in->type == DOUBLE && out->type == DOUBLE && divider->type == DOUBLE) {
+            double d = *(double*) divider->data;
+            double* src = (double*) in->data + row*dims[0];
+            double* dst = (double*) out->data + row*dims[1];
+            for (size_t col = 0; col < cols; col++) {
+                dst[col] = src[col] / d;
+            }
+        }
+        else {
+            double d = hostLoadReal(divider, 0);
+            for (size_t col = 0; col < cols; col++) {
+                hostStoreReal(out, row*dims[1] + col, hostLoadReal(in, row*dims[0] + col) / d);
+            }
+        }
+    }
+}
 
-    float* rawHostMatrix = (float*) malloc(sizeof(float)*hostMatrixLens[0]*hostMatrixLens[1]);
-    float* toFree = rawHostMatrix;
+cl_int runHostDivide(HOST_LAUNCH* launch) {
+    size_t dims[2];
+    size_t rows = launch->global[0];
+    size_t cols = launch->global[1];
+    if (!hostParams(launch, 0, dims, 2) || hostCells(launch->args[1]) < 1) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(launch->args[2], rows, cols, dims[0]) || !hostFits(launch->args[3], rows, cols, dims[1])) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostDivideRange, launch, rows, cols);
+    return CL_SUCCESS;
+}
 
-    size_t origin[] = {0, 0, 0};
-    size_t region[] = {hostMatrixLens[1], hostMatrixLens[0], 1};
+//intToDoubleB, dims = {pitch in, pitch out}: out = (REAL) in
+void hostIntToRealRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t dims[2];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return;
+    }
+    HOST_MEM* in = launch->args[1];
+    HOST_MEM* out = launch->args[2];
+    size_t cols = launch->global[1];
+    for (size_t row = from; row < to; row++) {
+        for (size_t col = 0; col < cols; col++) {
+            hostStoreReal(out, row*dims[1] + col, (double) hostLoadInt(in, row*dims[0] + col));
+        }
+    }
+}
 
-    int CL_Err = clEnqueueReadImage(queue, memObj, CL_TRUE, origin, region, 0, 0, rawHostMatrix, 0, NULL, NULL);
-    if (CL_Err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueReadImage", CL_Err));
-        api->returnEl(cframe, NULL);
-        return RETURN_OK;
+cl_int runHostIntToReal(HOST_LAUNCH* launch) {
+    size_t dims[2];
+    size_t rows = launch->global[0];
+    size_t cols = launch->global[1];
+    if (!hostParams(launch, 0, dims, 2)) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(launch->args[1], rows, cols, dims[0]) || !hostFits(launch->args[2], rows, cols, dims[1])) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostIntToRealRange, launch, rows, cols);
+    return CL_SUCCESS;
+}
+
+/*
+ * randmatdb, randmatib (seed, lohi, dims = {pitch}, matrix) and
+ * randvecd, randveci (seed, lohi, vector): the generator of the
+ * random kernels, cell for cell, so a seed gives the same values on
+ * the host as on an OpenCL device (up to rounding for half)
+ */
+#define HOST_RAND_REAL 0
+#define HOST_RAND_INT 1
+
+uint32_t hostRandInt(uint32_t top, uint32_t seed) {
+    if (top == 0) {
+        return 0;
+    }
+    uint32_t lo = 16807 * (seed * 0xFFFF);
+    uint32_t hi = 16807 * (seed >> 16);
+    lo += (hi & 0x7FFF) << 16;
+    lo += hi >> 15;
+    if (lo > 0x7FFFFFFF) {
+        lo -= 0x7FFFFFFF;
     }
+    return lo % top;
+}
+
+//the kernels' (seed + row*row + col)*(seed + row + col) with int row and col
+uint32_t hostRandSeed(uint64_t seed, size_t row, size_t col) {
+    int64_t r = (int32_t) row;
+    int64_t c = (int32_t) col;
+    int64_t square = (int32_t) ((uint32_t) row*(uint32_t) row);
+    return (uint32_t) ((seed + (uint64_t) square + (uint64_t) c)*(seed + (uint64_t) r + (uint64_t) c));
+}
 
-    DanaEl* hostMatrix = api->makeArrayMD(decMatrixGT, 2, hostMatrixLens, NULL);
-    for (int i = 0; i < hostMatrixLens[0]; i++) {
-        for (int j = 0; j < hostMatrixLens[1]; j++) {
-            api->setArrayCellDec(hostMatrix, (i*hostMatrixLens[1])+j, *rawHostMatrix);
-            rawHostMatrix++;
+void hostRandRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    uint8_t isMatrix = launch->args[3] != NULL;
+    HOST_MEM* lohi = launch->args[1];
+    HOST_MEM* out = isMatrix ? launch->args[3] : launch->args[2];
+    size_t pitch = isMatrix ? (size_t) hostLoadInt(launch->args[2], 0) : 1;
+    size_t cols = isMatrix ? launch->global[1] : 1;
+    uint64_t seed = (uint64_t) hostLoadInt(launch->args[0], 0);
+    for (size_t row = from; row < to; row++) {
+        for (size_t col = 0; col < cols; col++) {
+            uint32_t cellSeed = hostRandSeed(seed, row, col);
+            if (launch->op == HOST_RAND_INT) {
+                uint32_t lo = (uint32_t) hostLoadInt(lohi, 0);
+                uint32_t diff = (uint32_t) hostLoadInt(lohi, 1) - lo;
+                hostStoreInt(out, row*pitch + col, (int64_t) (uint32_t) (lo + hostRandInt(diff + 1, cellSeed)));
+                continue;
+            }
+            uint32_t stepsMax = hostRandInt(10001, cellSeed);
+            uint32_t stepsTaken = hostRandInt(stepsMax + 1, cellSeed);
+            if (out->type == DOUBLE) {
+                double lo = hostLoadReal(lohi, 0);
+                double increments = (hostLoadReal(lohi, 1) - lo) / stepsMax;
+                hostStoreReal(out, row*pitch + col, lo + increments*stepsTaken);
+            }
+            else {
+                float lo = (float) hostLoadReal(lohi, 0);
+                float increments = ((float) hostLoadReal(lohi, 1) - lo) / stepsMax;
+                hostStoreReal(out, row*pitch + col, lo + increments*stepsTaken);
+            }
         }
     }
+}
 
-    api->returnEl(cframe, hostMatrix);
-    free(toFree);
-    return RETURN_OK;    
+cl_int runHostRand(HOST_LAUNCH* launch) {
+    uint8_t isMatrix = launch->args[3] != NULL;
+    size_t rows = launch->global[0];
+    size_t cols = isMatrix ? launch->global[1] : 1;
+    size_t pitch = 1;
+    if (hostCells(launch->args[0]) < 1 || hostCells(launch->args[1]) < 2 || (isMatrix && !hostParams(launch, 2, &pitch, 1))) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (!hostFits(isMatrix ? launch->args[3] : launch->args[2], rows, cols, pitch)) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostRandRange, launch, rows, cols);
+    return CL_SUCCESS;
 }
 
-INSTRUCTION_DEF destroyMemoryArea(FrameData* cframe) {
+/*
+ * philoxu, philoxn, philoxi (params = {seed, stream, first, cells,
+ * cols, pitch}, lohi, out): the Philox4x32-10 generator of philox.cl,
+ * a block of 4 cells per work-item. Int cells match a device's
+ * exactly, uniform and normal ones are computed in double so match
+ * up to rounding
+ */
+#define HOST_PHILOX_UNIFORM 0
+#define HOST_PHILOX_NORMAL 1
+#define HOST_PHILOX_INT 2
+
+void hostPhilox(uint64_t block, uint64_t stream, uint64_t seed, uint32_t* words) {
+    uint32_t c0 = (uint32_t) block;
+    uint32_t c1 = (uint32_t) (block >> 32);
+    uint32_t c2 = (uint32_t) stream;
+    uint32_t c3 = (uint32_t) (stream >> 32);
+    uint32_t k0 = (uint32_t) seed;
+    uint32_t k1 = (uint32_t) (seed >> 32);
+    for (int r = 0; r < 10; r++) {
+        uint64_t p0 = (uint64_t) 0xD2511F53*c0;
+        uint64_t p1 = (uint64_t) 0xCD9E8D57*c2;
+        c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t) p1;
+        c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t) p0;
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+    words[0] = c0;
+    words[1] = c1;
+    words[2] = c2;
+    words[3] = c3;
+}
+
+double hostPhiloxUnit(uint32_t w) {
+    return ((double) (w >> 8) + 0.5)*(1.0/16777216.0);
+}
+
+void hostPhiloxRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t params[6];
+    if (!hostParams(launch, 0, params, 6)) {
+        return;
+    }
+    HOST_MEM* lohi = launch->args[1];
+    HOST_MEM* out = launch->args[2];
+    size_t first = params[2];
+    size_t cells = params[3];
+    for (size_t item = from; item < to; item++) {
+        uint64_t block = first/4 + item;
+        uint32_t w[4];
+        double value[4];
+        hostPhilox(block, (uint64_t) params[1], (uint64_t) params[0], w);
+        if (launch->op == HOST_PHILOX_NORMAL) {
+            double r0 = sqrt(-2.0*log(hostPhiloxUnit(w[0])));
+            double t0 = 6.283185307179586*hostPhiloxUnit(w[1]);
+            double r1 = sqrt(-2.0*log(hostPhiloxUnit(w[2])));
+            double t1 = 6.283185307179586*hostPhiloxUnit(w[3]);
+            value[0] = r0*cos(t0);
+            value[1] = r0*sin(t0);
+            value[2] = r1*cos(t1);
+            value[3] = r1*sin(t1);
+        }
+        for (int k = 0; k < 4; k++) {
+            size_t c = block*4 + k;
+            if (c < first || c >= first + cells) {
+                continue;
+            }
+            size_t j = c - first;
+            size_t at = (j/params[4])*params[5] + j % params[4];
+            if (launch->op == HOST_PHILOX_INT) {
+                int64_t lo = hostLoadInt(lohi, 0);
+                uint64_t range = (uint64_t) (hostLoadInt(lohi, 1) - lo) + 1;
+                uint64_t step = (uint64_t) w[k]*(range >> 32) + (((uint64_t) w[k]*(uint32_t) range) >> 32);
+                hostStoreInt(out, at, lo + (int64_t) step);
+            }
+            else if (launch->op == HOST_PHILOX_NORMAL) {
+                hostStoreReal(out, at, hostLoadReal(lohi, 0) + hostLoadReal(lohi, 1)*value[k]);
+            }
+            else {
+                double lo = hostLoadReal(lohi, 0);
+                hostStoreReal(out, at, lo + (hostLoadReal(lohi, 1) - lo)*hostPhiloxUnit(w[k]));
+            }
+        }
+    }
+}
+
+cl_int runHostPhilox(HOST_LAUNCH* launch) {
+    size_t params[6];
+    if (!hostParams(launch, 0, params, 6) || params[4] == 0 || hostCells(launch->args[1]) < 2) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    size_t rows = (params[3] + params[4] - 1)/params[4];
+    if (!hostFits(launch->args[2], rows, params[3] < params[4] ? params[3] : params[4], params[5])) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+    runHostRange(hostPhiloxRange, launch, launch->global[0], 4);
+    return CL_SUCCESS;
+}
+
+/*
+ * reduced, reducei (params = {n, op, cols, pitch}, in, out), dotd, doti
+ * (params = {n, op, cols, pitch}, A, B, out) and argreduced, argreducei
+ * (params = {n, op, indexed, cols, pitch}, in, inIdx, outVal, outIdx).
+ * Work-group g of a launch with global size G and work-group size RS
+ * folds the cells whose work-item (i mod G) falls in it, that is the
+ * runs [g*RS + m*G, g*RS + m*G + RS), into out[g], so the partials
+ * match those of an OpenCL device (up to the order of summation) and
+ * the same second pass finishes them. Int partials are signed 64 bit,
+ * real ones are in the precision of the output
+ */
+#define HOST_REDUCE 0
+#define HOST_DOT 1
+#define HOST_ARGREDUCE 2
+
+size_t hostCellOffset(size_t i, size_t cols, size_t pitch) {
+    return cols == pitch ? i : (i / cols)*pitch + i % cols;
+}
+
+double hostCombineReal(double a, double b, size_t op) {
+    switch (op) {
+        case 1: return a*b;
+        //as fmin and fmax, a NaN loses to a number
+        case 2: return b != b || a < b ? a : b;
+        case 3: return b != b || a > b ? a : b;
+        default: return a + b;
+    }
+}
+
+int64_t hostCombineInt(int64_t a, int64_t b, size_t op) {
+    switch (op) {
+        case 1: return (int64_t) ((uint64_t) a*(uint64_t) b);
+        case 2: return a < b ? a : b;
+        case 3: return a > b ? a : b;
+        default: return (int64_t) ((uint64_t) a + (uint64_t) b);
+    }
+}
+
+//true if (vb, ib) should replace (va, ia), as betterd/betteri
+uint8_t hostBetter(double va, size_t ia, double vb, size_t ib, size_t op) {
+    if (vb == va) {
+        return ib < ia;
+    }
+    return op == 2 ? vb < va : vb > va;
+}
+
+uint8_t hostBetterInt(int64_t va, size_t ia, int64_t vb, size_t ib, size_t op) {
+    if (vb == va) {
+        return ib < ia;
+    }
+    return op == 2 ? vb < va : vb > va;
+}
+
+void hostReduceRange(void* job, size_t from, size_t to) {
+    HOST_LAUNCH* launch = (HOST_LAUNCH*) job;
+    size_t params[5];
+    uint8_t arg = launch->op == HOST_ARGREDUCE;
+    if (!hostParams(launch, 0, params, arg ? 5 : 4)) {
+        return;
+    }
+    size_t n = params[0];
+    size_t op = params[1];
+    uint8_t indexed = arg && params[2] != 0;
+    size_t cols = params[arg ? 3 : 2];
+    size_t pitch = params[arg ? 4 : 3];
+    HOST_MEM* in = launch->args[1];
+    HOST_MEM* second = launch->args[2];
+    HOST_MEM* out = launch->args[launch->op == HOST_REDUCE ? 2 : 3];
+    uint8_t real = isRealType(out->type);
+    size_t groupSize = launch->local[0];
+    size_t globalSize = launch->global[0];
+    for (size_t g = from; g < to; g++) {
+        double realAcc = launch->op == HOST_ARGREDUCE ? (op == 2 ? INFINITY : -INFINITY) : (op == 1 ? 1 : (op == 2 ? INFINITY : (op == 3 ? -INFINITY : 0)));
+        int64_t intAcc = launch->op == HOST_ARGREDUCE ? (op == 2 ? INT64_MAX : INT64_MIN) : (op == 1 ? 1 : (op == 2 ? INT64_MAX : (op == 3 ? INT64_MIN : 0)));
+        size_t idx = SIZE_MAX;
+        for (size_t base = g*groupSize; base < n; base += globalSize) {
+            size_t end = n - base < groupSize ? n : base + groupSize;
+            if (launch->op == HOST_DOT && cols == pitch && in->type == FLOAT && second->type == FLOAT) {
+                realAcc += hostDotFloat((float*) in->data + base, (float*) second->data + base, end - base);
+                continue;
+            }
+            if (launch->op == HOST_DOT && cols == pitch && in->type == DOUBLE && second->type == DOUBLE) {
+                realAcc += hostDotDouble((double*) in->data + base, (double*) second->data + base, end - base);
+                continue;
+            }
+            for (size_t i = base; i < end; i++) {
+                size_t cell = hostCellOffset(i, cols, pitch);
+                if (launch->op == HOST_ARGREDUCE) {
+                    size_t at = indexed ? (size_t) hostLoadInt(second, i) : i;
+                    if (real && hostBetter(realAcc, idx, hostLoadReal(in, cell), at, op)) {
+                        realAcc = hostLoadReal(in, cell);
+                        idx = at;
+                    }
+                    else if (!real && hostBetterInt(intAcc, idx, hostLoadInt(in, cell), at, op)) {
+                        intAcc = hostLoadInt(in, cell);
+                        idx = at;
+                    }
+                }
+                else if (launch->op == HOST_DOT) {
+                    if (real) {
+                        realAcc += hostLoadReal(in, cell)*hostLoadReal(second, cell);
+                    }
+                    else {
+                        intAcc = (int64_t) ((uint64_t) intAcc + (uint64_t) hostLoadInt(in, cell)*(uint64_t) hostLoadInt(second, cell));
+                    }
+                }
+                else if (real) {
+                    realAcc = hostCombineReal(realAcc, hostLoadReal(in, cell), op);
+                }
+                else {
+                    intAcc = hostCombineInt(intAcc, hostLoadInt(in, cell), op);
+                }
+            }
+        }
+        if (real) {
+            hostStoreReal(out, g, realAcc);
+        }
+        else {
+            hostStoreInt(out, g, intAcc);
+        }
+        if (launch->op == HOST_ARGREDUCE) {
+            hostStoreInt(launch->args[4], g, (int64_t) idx);
+        }
+    }
+}
+
+cl_int runHostReduce(HOST_LAUNCH* launch) {
+    size_t params[5];
+    uint8_t arg = launch->op == HOST_ARGREDUCE;
+    if (!hostParams(launch, 0, params, arg ? 5 : 4)) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    size_t n = params[0];
+    size_t cols = params[arg ? 3 : 2];
+    size_t pitch = params[arg ? 4 : 3];
+    size_t groupSize = launch->local[0];
+    size_t groups = launch->global[0] / groupSize;
+    if (groups == 0 || launch->global[0] % groupSize != 0) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+    if (cols == 0 || pitch < cols) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (n > 0 && hostCellOffset(n - 1, cols, pitch) >= hostCells(launch->args[1])) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (launch->op == HOST_DOT && n > 0 && hostCellOffset(n - 1, cols, pitch) >= hostCells(launch->args[2])) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if (arg && params[2] != 0 && hostCells(launch->args[2]) < n) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    //the outputs, a cell per work-group
+    for (size_t i = launch->op == HOST_REDUCE ? 2 : 3; i < (launch->op == HOST_REDUCE ? 3 : (arg ? 5 : 4)); i++) {
+        if (hostCells(launch->args[i]) < groups) {
+            return CL_INVALID_GLOBAL_WORK_SIZE;
+        }
+    }
+    runHostRange(hostReduceRange, launch, groups, n / groups + 1);
+    return CL_SUCCESS;
+}
+
+/*
+ * The kernels the host device implements, by function name. Any
+ * other kernel (the image kernels, or the programs Elementwise
+ * generates) fails to be created on the host
+ */
+typedef struct _host_kernel_def {
+    char* name;
+    size_t argCount;
+    uint8_t op;
+    cl_int (*run)(HOST_LAUNCH* launch);
+} HOST_KERNEL_DEF;
+
+HOST_KERNEL_DEF hostKernels[] = {
+    {"vaddi", 3, HOST_OP_ADD, runHostBinary},
+    {"vaddd", 3, HOST_OP_ADD, runHostBinary},
+    {"vcombi", 3, HOST_OP_MUL, runHostBinary},
+    {"vcombd", 3, HOST_OP_MUL, runHostBinary},
+    {"vscalei", 2, 0, runHostScale},
+    {"vscaled", 2, 0, runHostScale},
+    {"lintransdb", 4, 0, runHostLintrans},
+    {"mattransdb", 3, 0, runHostTranspose},
+    {"gemm_tiled", 4, 0, runHostGemm},
+    {"gemm_blocked", 4, 0, runHostGemm},
+    {"gemm_batched", 4, HOST_BATCH_GEMM, runHostBatched},
+    {"gemv_batched", 4, HOST_BATCH_GEMV, runHostBatched},
+    {"transpose_batched", 3, HOST_BATCH_TRANSPOSE, runHostBatched},
+    {"spmv_scalar", 7, HOST_SPMV, runHostSparse},
+    {"spmv_vector", 7, HOST_SPMV, runHostSparse},
+    {"spmm_scalar", 7, HOST_SPMM, runHostSparse},
+    {"spmm_vector", 7, HOST_SPMM, runHostSparse},
+    {"chopColumnFB", 3, HOST_CHOP_COLUMN, runHostChop},
+    {"chopColumnIB", 3, HOST_CHOP_COLUMN, runHostChop},
+    {"chopRowFB", 3, HOST_CHOP_ROW, runHostChop},
+    {"chopRowIB", 3, HOST_CHOP_ROW, runHostChop},
+    {"floatDivB", 4, 0, runHostDivide},
+    {"intToDoubleB", 3, 0, runHostIntToReal},
+    {"randmatdb", 4, HOST_RAND_REAL, runHostRand},
+    {"randmatib", 4, HOST_RAND_INT, runHostRand},
+    {"randvecd", 3, HOST_RAND_REAL, runHostRand},
+    {"randveci", 3, HOST_RAND_INT, runHostRand},
+    {"philoxu", 3, HOST_PHILOX_UNIFORM, runHostPhilox},
+    {"philoxn", 3, HOST_PHILOX_NORMAL, runHostPhilox},
+    {"philoxi", 3, HOST_PHILOX_INT, runHostPhilox},
+    {"reduced", 3, HOST_REDUCE, runHostReduce},
+    {"reducei", 3, HOST_REDUCE, runHostReduce},
+    {"dotd", 4, HOST_DOT, runHostReduce},
+    {"doti", 4, HOST_DOT, runHostReduce},
+    {"argreduced", 5, HOST_ARGREDUCE, runHostReduce},
+    {"argreducei", 5, HOST_ARGREDUCE, runHostReduce},
+};
+#define HOST_KERNEL_COUNT (sizeof(hostKernels)/sizeof(HOST_KERNEL_DEF))
+
+//a host "cl_kernel": the implementation and the arguments bound to it
+typedef struct _host_kernel {
+    HOST_KERNEL_DEF* def;
+    size_t args[HOST_MAX_ARGS];
+    size_t argCount;
+} HOST_KERNEL;
+
+cl_kernel createHostKernel(cl_program program, char* functionName, cl_int* CL_err) {
+    HOST_PROGRAM* prog = (HOST_PROGRAM*) program;
+    *CL_err = CL_INVALID_KERNEL_NAME;
+    if (!hostDeclaresKernel(prog->source, functionName)) {
+        return NULL;
+    }
+    for (size_t i = 0; i < HOST_KERNEL_COUNT; i++) {
+        if (strcmp(hostKernels[i].name, functionName) == 0) {
+            HOST_KERNEL* kernel = (HOST_KERNEL*) calloc(1, sizeof(HOST_KERNEL));
+            kernel->def = &hostKernels[i];
+            *CL_err = CL_SUCCESS;
+            return (cl_kernel) kernel;
+        }
+    }
+    return NULL;
+}
+
+cl_int setHostKernelArg(cl_kernel kernel, size_t index, size_t arg) {
+    HOST_KERNEL* hostKernel = (HOST_KERNEL*) kernel;
+    if (index >= hostKernel->def->argCount) {
+        return CL_INVALID_ARG_INDEX;
+    }
+    hostKernel->args[index] = arg;
+    return CL_SUCCESS;
+}
+
+/*
+ * Runs a host kernel to completion. Unlike an OpenCL launch, each
+ * argument is checked to be a live host buffer first
+ */
+int runHostKernel(cl_kernel kernel, DanaEl* rawOutputDimentions, DanaEl* rawLocalDimentions) {
+    HOST_KERNEL* hostKernel = (HOST_KERNEL*) kernel;
+    HOST_KERNEL_DEF* def = hostKernel->def;
+    HOST_LAUNCH launch;
+    memset(&launch, 0, sizeof(HOST_LAUNCH));
+    launch.op = def->op;
+
+    if (hostKernel->argCount != def->argCount) {
+        addLog(def->name, CL_INVALID_KERNEL_ARGS, kernel);
+        return 1;
+    }
+    for (size_t i = 0; i < def->argCount; i++) {
+        launch.args[i] = findHostMem((cl_mem) hostKernel->args[i]);
+        if (launch.args[i] == NULL) {
+            addLog(def->name, CL_INVALID_MEM_OBJECT, (void*) hostKernel->args[i]);
+            return 1;
+        }
+    }
+
+    size_t dims = api->getArrayLength(rawOutputDimentions);
+    if (dims == 0 || dims > 3) {
+        addLog(def->name, CL_INVALID_WORK_DIMENSION, kernel);
+        return 1;
+    }
+    uint8_t hasLocal = rawLocalDimentions != NULL && api->getArrayLength(rawLocalDimentions) == dims;
+    for (size_t i = 0; i < 3; i++) {
+        launch.global[i] = i < dims ? api->getArrayCellInt(rawOutputDimentions, i) : 1;
+        //without a work-group size the launch is one work-group
+        launch.local[i] = i < dims && hasLocal ? api->getArrayCellInt(rawLocalDimentions, i) : launch.global[i];
+        if (launch.local[i] == 0) {
+            addLog(def->name, CL_INVALID_WORK_GROUP_SIZE, kernel);
+            return 1;
+        }
+    }
+
+    uint64_t start = nowNs();
+    cl_int CL_err = def->run(&launch);
+    if (CL_err != CL_SUCCESS) {
+        addLog(def->name, CL_err, kernel);
+        return 1;
+    }
+    recordHostProfile(def->name, 0, nowNs() - start);
+    return 0;
+}
+
+/*
+ * Kernels are cached per (program, function name, queue) so that
+ * repeated launches of the same Program through the same Compute
+ * reuse one cl_kernel. The arguments last bound to each cached
+ * kernel are remembered so a launch only calls clSetKernelArg for
+ * the parameters that actually changed. The list is shared by every
+ * thread, but a cached kernel's arguments are only bound by the one
+ * caller its queue is running for (see Compute's run lock)
+ */
+typedef struct _kernel_list_item {
+    cl_program program;
+    cl_command_queue queue;
+    char* functionName;
+    cl_kernel kernel;
+    size_t* boundArgs;
+    size_t argCount;
+    struct _kernel_list_item* next;
+} KERNEL_LI;
+
+KERNEL_LI* kernelCache = NULL;
+size_t kernelCreations = 0;
+size_t kernelCacheHits = 0;
+size_t kernelArgsSet = 0;
+size_t kernelArgsSkipped = 0;
+pthread_mutex_t kernelCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+KERNEL_LI* findCachedKernel(cl_program program, cl_command_queue queue, char* functionName) {
+    for (KERNEL_LI* probe = kernelCache; probe != NULL; probe = probe->next) {
+        if (probe->program == program && probe->queue == queue && strcmp(probe->functionName, functionName) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Releases every cached kernel built from program (if non-null)
+ * or bound to queue (if non-null)
+ */
+void evictCachedKernels(cl_program program, cl_command_queue queue) {
+    pthread_mutex_lock(&kernelCacheLock);
+    KERNEL_LI* prev = NULL;
+    KERNEL_LI* probe = kernelCache;
+    while (probe != NULL) {
+        KERNEL_LI* next = probe->next;
+        if ((program != NULL && probe->program == program) || (queue != NULL && probe->queue == queue)) {
+            if (prev == NULL) {
+                kernelCache = next;
+            }
+            else {
+                prev->next = next;
+            }
+            if (isHostQueue(probe->queue)) {
+                free(probe->kernel);
+            }
+            else {
+                clReleaseKernel(probe->kernel);
+            }
+            free(probe->functionName);
+            free(probe->boundArgs);
+            free(probe);
+        }
+        else {
+            prev = probe;
+        }
+        probe = next;
+    }
+    pthread_mutex_unlock(&kernelCacheLock);
+}
+
+/*
+ * Returns [kernels created, cache hits, args set, args skipped, kernels cached]
+ */
+INSTRUCTION_DEF getKernelCacheStats(FrameData* cframe) {
+    size_t cached = 0;
+    pthread_mutex_lock(&kernelCacheLock);
+    for (KERNEL_LI* probe = kernelCache; probe != NULL; probe = probe->next) {
+        cached++;
+    }
+    pthread_mutex_unlock(&kernelCacheLock);
+
+    DanaEl* returnArray = api->makeArray(intArrayGT, 5, NULL);
+    api->setArrayCellInt(returnArray, 0, kernelCreations);
+    api->setArrayCellInt(returnArray, 1, kernelCacheHits);
+    api->setArrayCellInt(returnArray, 2, kernelArgsSet);
+    api->setArrayCellInt(returnArray, 3, kernelArgsSkipped);
+    api->setArrayCellInt(returnArray, 4, cached);
+
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF destroyQueue(FrameData* cframe) {
     cl_int CL_err = CL_SUCCESS;
     size_t rawParam = api->getParamInt(cframe, 0);
-    cl_mem memObj = (cl_mem) rawParam; 
-    //the next line seg faults if memObj has already been released...
-    //averting this has been attemted in dana, but I'll leave this note
-    //here just in case
-    CL_err = clReleaseMemObject(memObj);
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clReleaseMemObject", CL_err));
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    evictCachedKernels(NULL, queue);
+    if (isHostQueue(queue)) {
+        freeHostQueue(queue);
+        return RETURN_OK;
+    }
+    CL_err = clReleaseCommandQueue(queue);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF destroyProgram(FrameData* cframe) {
+    cl_int CL_err = CL_SUCCESS;
+    size_t rawParam = api->getParamInt(cframe, 0);
+    cl_program prog = (cl_program) rawParam;
+    evictCachedKernels(prog, NULL);
+    if (freeHostProgram(prog)) {
         return RETURN_OK;
     }
-    return RETURN_OK;
+    CL_err = clReleaseProgram(prog);
+    return RETURN_OK;
+}
+
+/*
+ * Compiled program binaries are kept in binaryCacheDir (if set),
+ * one file per hash of the source, build options and the platform,
+ * device and driver the program was built for. A file whose header
+ * doesn't match, or whose binary the driver rejects, is ignored and
+ * overwritten by a fresh source build.
+ */
+char* binaryCacheDir = NULL;
+size_t binaryCacheHits = 0;
+size_t binaryCacheMisses = 0;
+size_t binaryCacheStores = 0;
+size_t binaryCacheWrites = 0;
+
+uint64_t fnv1a(uint64_t hash, const void* data, size_t len) {
+    const unsigned char* bytes = (const unsigned char*) data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t fnv1aInfoString(uint64_t hash, char* info) {
+    //include the terminator so "ab"+"c" hashes differently to "a"+"bc"
+    return fnv1a(hash, info, strlen(info)+1);
+}
+
+uint64_t programCacheKey(char* source, char* options, cl_platform_id platform, cl_device_id device) {
+    char info[1024];
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = fnv1aInfoString(hash, source);
+    hash = fnv1aInfoString(hash, options);
+
+    info[0] = '\0';
+    clGetPlatformInfo(platform, CL_PLATFORM_NAME, sizeof(info), info, NULL);
+    hash = fnv1aInfoString(hash, info);
+    info[0] = '\0';
+    clGetPlatformInfo(platform, CL_PLATFORM_VERSION, sizeof(info), info, NULL);
+    hash = fnv1aInfoString(hash, info);
+    info[0] = '\0';
+    clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(info), info, NULL);
+    hash = fnv1aInfoString(hash, info);
+    info[0] = '\0';
+    clGetDeviceInfo(device, CL_DRIVER_VERSION, sizeof(info), info, NULL);
+    hash = fnv1aInfoString(hash, info);
+    return hash;
+}
+
+char* binaryCachePath(uint64_t key) {
+    size_t len = strlen(binaryCacheDir) + 32;
+    char* path = (char*) malloc(len);
+    snprintf(path, len, "%s/%016llx.clbin", binaryCacheDir, (unsigned long long) key);
+    return path;
+}
+
+/*
+ * Returns a program created from the cached binary for key, or
+ * 0 if there isn't a usable one. The program is not yet built
+ */
+cl_program loadCachedBinary(cl_context context, cl_device_id device, uint64_t key) {
+    if (binaryCacheDir == NULL) {
+        return 0;
+    }
+    char* path = binaryCachePath(key);
+    FILE* fp = fopen(path, "rb");
+    free(path);
+    if (fp == NULL) {
+        return 0;
+    }
+
+    uint64_t header[3];
+    if (fread(header, sizeof(uint64_t), 3, fp) != 3 || header[0] != BINARY_CACHE_MAGIC || header[1] != key || header[2] == 0) {
+        fclose(fp);
+        return 0;
+    }
+    size_t binarySize = (size_t) header[2];
+    unsigned char* binary = (unsigned char*) malloc(binarySize);
+    if (fread(binary, 1, binarySize, fp) != binarySize) {
+        free(binary);
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+
+    cl_int binaryStatus = CL_SUCCESS;
+    cl_int CL_err = CL_SUCCESS;
+    cl_program prog = clCreateProgramWithBinary(context, 1, &device, &binarySize, (const unsigned char**) &binary, &binaryStatus, &CL_err);
+    free(binary);
+    if (CL_err != CL_SUCCESS || binaryStatus != CL_SUCCESS) {
+        if (prog != 0) {
+            clReleaseProgram(prog);
+        }
+        return 0;
+    }
+    return prog;
+}
+
+void storeCachedBinary(cl_program prog, uint64_t key) {
+    if (binaryCacheDir == NULL) {
+        return;
+    }
+    size_t binarySize = 0;
+    cl_int CL_err = clGetProgramInfo(prog, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &binarySize, NULL);
+    if (CL_err != CL_SUCCESS || binarySize == 0) {
+        return;
+    }
+    unsigned char* binary = (unsigned char*) malloc(binarySize);
+    CL_err = clGetProgramInfo(prog, CL_PROGRAM_BINARIES, sizeof(unsigned char*), &binary, NULL);
+    if (CL_err != CL_SUCCESS) {
+        free(binary);
+        return;
+    }
+
+    //write to a temporary name first so a concurrent reader never sees half a file,
+    //numbered so two threads storing the same program don't write the same one
+    char* path = binaryCachePath(key);
+    size_t tmpLen = strlen(path) + 32;
+    char* tmpPath = (char*) malloc(tmpLen);
+    snprintf(tmpPath, tmpLen, "%s.%llu.tmp", path, (unsigned long long) __atomic_add_fetch(&binaryCacheWrites, 1, __ATOMIC_RELAXED));
+    FILE* fp = fopen(tmpPath, "wb");
+    if (fp != NULL) {
+        uint64_t header[3] = {BINARY_CACHE_MAGIC, key, (uint64_t) binarySize};
+        size_t written = fwrite(header, sizeof(uint64_t), 3, fp);
+        written += fwrite(binary, 1, binarySize, fp);
+        uint8_t complete = fclose(fp) == 0 && written == 3 + binarySize;
+#ifdef WINDOWS
+        //rename won't replace an existing file here, so the old one goes, but only
+        //once the new one is whole
+        if (complete) {
+            remove(path);
+        }
+#endif
+        //elsewhere rename replaces any old file in one step
+        if (complete && rename(tmpPath, path) == 0) {
+            __atomic_fetch_add(&binaryCacheStores, 1, __ATOMIC_RELAXED);
+        }
+        else {
+            remove(tmpPath);
+        }
+    }
+    free(tmpPath);
+    free(path);
+    free(binary);
 }
 
-INSTRUCTION_DEF destroyContextSpace(FrameData* cframe) {
-    size_t rawParam = api->getParamInt(cframe, 0);
-    DANA_COMP* comp = (DANA_COMP*) rawParam;
-    destroyContexts(comp);
-    return RETURN_OK;
+void makeCacheDir(char* path) {
+#ifdef WINDOWS
+    _mkdir(path);
+#else
+    mkdir(path, 0755);
+#endif
 }
 
-INSTRUCTION_DEF destroyQueue(FrameData* cframe) {
-    cl_int CL_err = CL_SUCCESS;
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_command_queue queue = (cl_command_queue) rawParam;
-    CL_err = clReleaseCommandQueue(queue);
+/*
+ * Sets the directory compiled program binaries are cached in,
+ * creating it if needed. An empty path turns the cache off
+ */
+INSTRUCTION_DEF setBinaryCacheDir(FrameData* cframe) {
+    char* path = x_getParam_char_array(api, cframe, 0);
+    free(binaryCacheDir);
+    binaryCacheDir = NULL;
+    if (strlen(path) == 0) {
+        free(path);
+        return RETURN_OK;
+    }
+    makeCacheDir(path);
+    binaryCacheDir = path;
     return RETURN_OK;
 }
 
-INSTRUCTION_DEF destroyProgram(FrameData* cframe) {
-    cl_int CL_err = CL_SUCCESS;
-    size_t rawParam = api->getParamInt(cframe, 0);
-    cl_program prog = (cl_program) rawParam;
-    CL_err = clReleaseProgram(prog);
+/*
+ * Returns [hits, misses, binaries stored] for the binary cache
+ */
+INSTRUCTION_DEF getBinaryCacheStats(FrameData* cframe) {
+    DanaEl* returnArray = api->makeArray(intArrayGT, 3, NULL);
+    api->setArrayCellInt(returnArray, 0, binaryCacheHits);
+    api->setArrayCellInt(returnArray, 1, binaryCacheMisses);
+    api->setArrayCellInt(returnArray, 2, binaryCacheStores);
+
+    api->returnEl(cframe, returnArray);
     return RETURN_OK;
 }
 
 /*
-    * Input: .cl program source code
-    * For each platform/context attached to a DANA_COMP attempt to build the program
+    * Input: .cl program source code, build options
+    * Build the program for the given device, from the binary cache if
+    * there is a matching entry, otherwise from source (storing the result)
     * If fails, print the compile errors
-    * Return: Array of built program IDs including 0s for those that failed
+    * A host device program keeps the source, which its kernels are
+    * looked up in when created
+    * Return: the built program ID, or 0 if the build failed
 */
 INSTRUCTION_DEF createProgram(FrameData* cframe) {
     cl_program prog = 0;
@@ -881,96 +5942,673 @@ INSTRUCTION_DEF createProgram(FrameData* cframe) {
     char* programSource = x_getParam_char_array(api, cframe, 0);
     *programStrings = programSource;
 
-    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 1);
+    char* options = x_getParam_char_array(api, cframe, 1);
+
+    DANA_COMP* danaComp = (DANA_COMP*) api->getParamInt(cframe, 2);
 
-    cl_device_id device = (cl_device_id) api->getParamInt(cframe, 2);
+    cl_device_id device = (cl_device_id) api->getParamInt(cframe, 3);
+
+    if (isHostDevice(device)) {
+        api->returnInt(cframe, (size_t) newHostProgram(programSource));
+        free(programStrings);
+        free(options);
+        return RETURN_OK;
+    }
 
     CONTEXT_LI* contextItem = getContextByDevice(danaComp, device);
 
+    uint64_t key = 0;
+    if (binaryCacheDir != NULL) {
+        key = programCacheKey(programSource, options, contextItem->platform, device);
+        prog = loadCachedBinary(contextItem->context, device, key);
+        if (prog != 0) {
+            CL_err = clBuildProgram(prog, 1, &device, options, NULL, NULL);
+            if (CL_err == CL_SUCCESS) {
+                __atomic_fetch_add(&binaryCacheHits, 1, __ATOMIC_RELAXED);
+                api->returnInt(cframe, (size_t) prog);
+                free(programSource);
+                free(programStrings);
+                free(options);
+                return RETURN_OK;
+            }
+            //stale binary (e.g. a driver update the key didn't catch), rebuild from source
+            clReleaseProgram(prog);
+            prog = 0;
+        }
+        __atomic_fetch_add(&binaryCacheMisses, 1, __ATOMIC_RELAXED);
+    }
+
+    CL_err = CL_SUCCESS;
     prog = clCreateProgramWithSource(contextItem->context, 1, (const char**) programStrings, NULL, &CL_err);
     if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateProgramWithSource", CL_err));
+        addLog("clCreateProgramWithSource", CL_err, device);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
 
     CL_err = CL_SUCCESS;
-    CL_err = clBuildProgram(prog, contextItem->numOfDevices, contextItem->devices, NULL, NULL, NULL);
+    CL_err = clBuildProgram(prog, 1, &device, options, NULL, NULL);
     if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clBuildProgram", CL_err));
+        addLog("clBuildProgram", CL_err, prog);
         size_t len;
         char buf[2048];
         printf("CL_err = %d\n", CL_err);
-        clGetProgramBuildInfo(prog, *(contextItem->devices), CL_PROGRAM_BUILD_LOG, sizeof(buf), buf, &len);
+        clGetProgramBuildInfo(prog, device, CL_PROGRAM_BUILD_LOG, sizeof(buf), buf, &len);
         printf("%s\n",buf);
         api->returnInt(cframe, (size_t) 0);
         return RETURN_OK;
     }
 
+    storeCachedBinary(prog, key);
+
     api->returnInt(cframe, (size_t) prog);
+    free(programSource);
     free(programStrings);
+    free(options);
 
     return RETURN_OK;
 }
 
 /*
-    * Input: program ID, number of parameters for the program, the opencl
-    * memory objects that make up the parameters, the program name
+ * A copy of the arguments last bound to a cached kernel, with their
+ * number in count, or NULL if the kernel isn't in the cache
+ */
+size_t* boundKernelArgs(cl_kernel kernel, size_t* count) {
+    size_t* args = NULL;
+    *count = 0;
+    pthread_mutex_lock(&kernelCacheLock);
+    for (KERNEL_LI* probe = kernelCache; probe != NULL; probe = probe->next) {
+        if (probe->kernel == kernel) {
+            *count = probe->argCount;
+            args = (size_t*) malloc(sizeof(size_t)*probe->argCount);
+            memcpy(args, probe->boundArgs, sizeof(size_t)*probe->argCount);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&kernelCacheLock);
+    return args;
+}
+
+/*
+    * Input: program ID, the queue the kernel will be launched through,
+    * the opencl memory objects that make up the parameters, the number
+    * of parameters, the program name
     *
-    * call opencl to create kernel
-    * if successful call opencl to set kernel parameters
+    * look for a kernel already created for this program/name/queue
+    * if there isn't one call opencl to create it and cache it
+    * then call opencl to set any kernel parameters that differ from
+    * the ones bound at the previous launch
     *
-    * if both succesful return kernel ID
+    * if successful return kernel ID
     * if not return 0
 */
 INSTRUCTION_DEF prepareKernel(FrameData* cframe) {
     size_t rawParam = api->getParamInt(cframe, 0);
     cl_program program = (cl_program) rawParam;
-    rawParam = api->getParamInt(cframe, 2);
+    rawParam = api->getParamInt(cframe, 1);
+    cl_command_queue queue = (cl_command_queue) rawParam;
+    rawParam = api->getParamInt(cframe, 3);
     size_t paramCount = (size_t) rawParam;
 
-    DanaEl* paramArray = api->getParamEl(cframe, 1);
-    size_t* rawParamArray = (size_t*) malloc(sizeof(size_t)*paramCount);
-    size_t* rawParamArrayCpy = rawParamArray;
-    for (int i = 0; i < paramCount; i++) {
-        *rawParamArrayCpy = (size_t) api->getArrayCellInt(paramArray, i);
-        rawParamArrayCpy++;
-    }
+    DanaEl* paramArray = api->getParamEl(cframe, 2);
 
-    char* progName = x_getParam_char_array(api, cframe, 3);
+    char* progName = x_getParam_char_array(api, cframe, 4);
 
     cl_int CL_err = CL_SUCCESS;
-    cl_kernel kernel = clCreateKernel(program, progName, &CL_err);
-
-    if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clCreateKernel", CL_err));
-        api->returnInt(cframe, (size_t) 0);
-        return RETURN_OK;
+    pthread_mutex_lock(&kernelCacheLock);
+    KERNEL_LI* cached = findCachedKernel(program, queue, progName);
+    if (cached != NULL) {
+        kernelCacheHits++;
+        free(progName);
     }
-
-    rawParamArrayCpy = rawParamArray;
-    for (int i = 0; i < paramCount; i++) {
-        rawParamArrayCpy++;
+    else {
+        cl_kernel kernel = isHostQueue(queue) ? createHostKernel(program, progName, &CL_err) : clCreateKernel(program, progName, &CL_err);
+        if (CL_err != CL_SUCCESS) {
+            pthread_mutex_unlock(&kernelCacheLock);
+            addLog(isHostQueue(queue) ? "createHostKernel" : "clCreateKernel", CL_err, program);
+            free(progName);
+            api->returnInt(cframe, (size_t) 0);
+            return RETURN_OK;
+        }
+        kernelCreations++;
+
+        cached = (KERNEL_LI*) malloc(sizeof(KERNEL_LI));
+        cached->program = program;
+        cached->queue = queue;
+        cached->functionName = progName;
+        cached->kernel = kernel;
+        cached->boundArgs = NULL;
+        cached->argCount = 0;
+        cached->next = kernelCache;
+        kernelCache = cached;
+    }
+    pthread_mutex_unlock(&kernelCacheLock);
+
+    //a different parameter count means nothing bound so far can be trusted
+    uint8_t rebindAll = 0;
+    if (cached->argCount != paramCount) {
+        free(cached->boundArgs);
+        cached->boundArgs = (size_t*) calloc(paramCount, sizeof(size_t));
+        cached->argCount = paramCount;
+        rebindAll = 1;
+        if (isHostQueue(queue)) {
+            ((HOST_KERNEL*) cached->kernel)->argCount = paramCount;
+        }
     }
 
-    CL_err = CL_SUCCESS;
-    rawParamArrayCpy = rawParamArray;
     for (int i = 0; i < paramCount; i++) {
-        CL_err = clSetKernelArg(kernel, i, sizeof(size_t), rawParamArrayCpy);
+        size_t arg = (size_t) api->getArrayCellInt(paramArray, i);
+        if (!rebindAll && cached->boundArgs[i] == arg) {
+            __atomic_fetch_add(&kernelArgsSkipped, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+        if (isHostQueue(queue)) {
+            CL_err = setHostKernelArg(cached->kernel, i, arg);
+        }
+        else {
+            CL_err = clSetKernelArg(cached->kernel, i, sizeof(size_t), &arg);
+        }
         if (CL_err != CL_SUCCESS) {
-            addLog(newLogItem("clSetKernelArg", CL_err));
+            addLog(isHostQueue(queue) ? "setHostKernelArg" : "clSetKernelArg", CL_err, cached->kernel);
+            //force a full rebind next time rather than trust a partial one
+            cached->argCount = 0;
             api->returnInt(cframe, (size_t) 0);
             return RETURN_OK;
         }
-        rawParamArrayCpy++;
+        cached->boundArgs[i] = arg;
+        __atomic_fetch_add(&kernelArgsSet, 1, __ATOMIC_RELAXED);
+    }
+
+    api->returnInt(cframe, (size_t) cached->kernel);
+
+    return RETURN_OK;
+
+}
+
+/*
+ * Work-group autotuning. A launch that leaves the local size to the
+ * runtime looks it up in a tuning table keyed by kernel function
+ * name, device, driver and global size, and launches with the
+ * stored local size if there is one. With tuning on, a blocking launch
+ * that misses first times the runtime's own choice and every power of
+ * two local size that divides the global size and fits the kernel,
+ * keeps the fastest and appends it to the tuning file, so later runs
+ * start tuned. Candidates run on scratch copies of the kernel's
+ * arguments, so the caller's data is never changed by tuning. The
+ * table also holds
+ * entries stored by callers under their own keys (see storeTuning),
+ * e.g. the tile sizes of programs built with different options.
+ *
+ * The tuning file has one entry per line: a count of values, the
+ * values, then the key to the end of the line. A key can appear more
+ * than once, the last line wins
+ */
+#define TUNING_FILE_ENV "DANA_OPENCL_TUNING"
+#define TUNING_MAX_VALUES 8
+#define TUNING_REPS 3
+#define TUNING_LINE_MAX 2048
+
+typedef struct _tuning_list_item {
+    char* key;
+    size_t count;
+    size_t values[TUNING_MAX_VALUES];
+    struct _tuning_list_item* next;
+} TUNING_LI;
+
+TUNING_LI* tuningTable = NULL;
+char* tuningFile = NULL;
+uint8_t tuningOn = 0;
+size_t tunedLaunches = 0;
+size_t tuningsRun = 0;
+size_t candidatesTimed = 0;
+//guards the table and the file, launches on many threads look sizes up at once
+pthread_mutex_t tuningLock = PTHREAD_MUTEX_INITIALIZER;
+
+TUNING_LI* findTuning(char* key) {
+    for (TUNING_LI* probe = tuningTable; probe != NULL; probe = probe->next) {
+        if (strcmp(probe->key, key) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+TUNING_LI* putTuning(char* key, size_t* values, size_t count) {
+    if (count > TUNING_MAX_VALUES) {
+        count = TUNING_MAX_VALUES;
+    }
+    TUNING_LI* entry = findTuning(key);
+    if (entry == NULL) {
+        entry = (TUNING_LI*) malloc(sizeof(TUNING_LI));
+        entry->key = strdup(key);
+        entry->next = tuningTable;
+        tuningTable = entry;
+    }
+    entry->count = count;
+    memcpy(entry->values, values, sizeof(size_t)*count);
+    return entry;
+}
+
+void clearTuning() {
+    while (tuningTable != NULL) {
+        TUNING_LI* next = tuningTable->next;
+        free(tuningTable->key);
+        free(tuningTable);
+        tuningTable = next;
+    }
+}
+
+void appendTuningFile(TUNING_LI* entry) {
+    if (tuningFile == NULL) {
+        return;
+    }
+    FILE* fp = fopen(tuningFile, "a");
+    if (fp == NULL) {
+        return;
+    }
+    fprintf(fp, "%llu", (unsigned long long) entry->count);
+    for (size_t i = 0; i < entry->count; i++) {
+        fprintf(fp, " %llu", (unsigned long long) entry->values[i]);
+    }
+    fprintf(fp, " %s\n", entry->key);
+    fclose(fp);
+}
+
+void loadTuningFile(char* path) {
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL) {
+        return;
+    }
+    char line[TUNING_LINE_MAX];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char* at = line;
+        char* end = NULL;
+        size_t count = (size_t) strtoull(at, &end, 10);
+        if (end == at || count > TUNING_MAX_VALUES) {
+            continue;
+        }
+        size_t values[TUNING_MAX_VALUES];
+        uint8_t ok = 1;
+        for (size_t i = 0; i < count && ok; i++) {
+            at = end;
+            values[i] = (size_t) strtoull(at, &end, 10);
+            ok = end != at;
+        }
+        //the key is what follows the single space after the values
+        if (ok && *end == ' ' && *(end+1) != '\0') {
+            putTuning(end+1, values, count);
+        }
+    }
+    fclose(fp);
+}
+
+char* workGroupKey(cl_kernel kernel, cl_command_queue queue, size_t dims, size_t* global) {
+    char name[256];
+    char deviceName[256];
+    char driver[256];
+    cl_device_id device = NULL;
+    name[0] = '\0';
+    deviceName[0] = '\0';
+    driver[0] = '\0';
+    clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, sizeof(name), name, NULL);
+    clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &device, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(deviceName), deviceName, NULL);
+    clGetDeviceInfo(device, CL_DRIVER_VERSION, sizeof(driver), driver, NULL);
+
+    char size[96];
+    int at = 0;
+    for (size_t i = 0; i < dims; i++) {
+        at += snprintf(size + at, sizeof(size) - at, i == 0 ? "%llu" : "x%llu", (unsigned long long) global[i]);
+    }
+    size_t len = strlen(name) + strlen(deviceName) + strlen(driver) + strlen(size) + 16;
+    char* key = (char*) malloc(len);
+    snprintf(key, len, "wg|%s|%s|%s|%s", name, deviceName, driver, size);
+    return key;
+}
+
+/*
+ * Fastest of TUNING_REPS blocking launches with the given local size
+ * (NULL for the runtime's choice), or UINT64_MAX if it can't launch
+ */
+uint64_t timeLaunch(cl_kernel kernel, cl_command_queue queue, size_t dims, size_t* global, size_t* local) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < TUNING_REPS; r++) {
+        cl_event event;
+        uint64_t start = nowNs();
+        if (clEnqueueNDRangeKernel(queue, kernel, dims, NULL, global, local, 0, NULL, &event) != CL_SUCCESS) {
+            return UINT64_MAX;
+        }
+        clWaitForEvents(1, &event);
+        clReleaseEvent(event);
+        uint64_t took = nowNs() - start;
+        if (took < best) {
+            best = took;
+        }
+    }
+    __atomic_fetch_add(&candidatesTimed, 1, __ATOMIC_RELAXED);
+    return best;
+}
+
+/*
+ * A new buffer or image like source, holding a copy of its contents
+ * enqueued on queue, or NULL if one couldn't be made
+ */
+cl_mem scratchCopy(cl_command_queue queue, cl_mem source) {
+    cl_mem_object_type kind = 0;
+    cl_context context = NULL;
+    cl_mem_flags flags = 0;
+    cl_int CL_err = clGetMemObjectInfo(source, CL_MEM_TYPE, sizeof(cl_mem_object_type), &kind, NULL);
+    CL_err |= clGetMemObjectInfo(source, CL_MEM_CONTEXT, sizeof(cl_context), &context, NULL);
+    CL_err |= clGetMemObjectInfo(source, CL_MEM_FLAGS, sizeof(cl_mem_flags), &flags, NULL);
+    if (CL_err != CL_SUCCESS) {
+        return NULL;
+    }
+    //the copy is the device's own, whatever host memory backs the source
+    flags &= CL_MEM_READ_WRITE | CL_MEM_READ_ONLY | CL_MEM_WRITE_ONLY;
+    cl_mem copy = NULL;
+    if (kind == CL_MEM_OBJECT_BUFFER) {
+        size_t size = 0;
+        clGetMemObjectInfo(source, CL_MEM_SIZE, sizeof(size_t), &size, NULL);
+        copy = clCreateBuffer(context, flags, size, NULL, &CL_err);
+        if (CL_err == CL_SUCCESS) {
+            CL_err = clEnqueueCopyBuffer(queue, source, copy, 0, 0, size, 0, NULL, NULL);
+        }
+    }
+    else if (kind == CL_MEM_OBJECT_IMAGE2D) {
+        cl_image_format format;
+        cl_image_desc desc;
+        memset(&desc, 0, sizeof(cl_image_desc));
+        desc.image_type = CL_MEM_OBJECT_IMAGE2D;
+        CL_err = clGetImageInfo(source, CL_IMAGE_FORMAT, sizeof(cl_image_format), &format, NULL);
+        CL_err |= clGetImageInfo(source, CL_IMAGE_WIDTH, sizeof(size_t), &desc.image_width, NULL);
+        CL_err |= clGetImageInfo(source, CL_IMAGE_HEIGHT, sizeof(size_t), &desc.image_height, NULL);
+        if (CL_err == CL_SUCCESS) {
+            copy = clCreateImage(context, flags, &format, &desc, NULL, &CL_err);
+        }
+        if (CL_err == CL_SUCCESS) {
+            size_t origin[3] = {0, 0, 0};
+            size_t region[3] = {desc.image_width, desc.image_height, 1};
+            CL_err = clEnqueueCopyImage(queue, source, copy, origin, origin, region, 0, NULL, NULL);
+        }
+    }
+    if (CL_err != CL_SUCCESS && copy != NULL) {
+        clReleaseMemObject(copy);
+        copy = NULL;
+    }
+    return copy;
+}
+
+/*
+ * Rebinds a kernel's own arguments after bindScratchArgs and
+ * releases the copies made of them
+ */
+void restoreArgs(cl_kernel kernel, size_t* args, cl_mem* scratch, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        cl_mem arg = (cl_mem) args[i];
+        clSetKernelArg(kernel, i, sizeof(cl_mem), &arg);
+        if (scratch[i] != NULL) {
+            clReleaseMemObject(scratch[i]);
+        }
+    }
+    free(args);
+    free(scratch);
+}
+
+/*
+ * Binds scratch copies of the arguments the kernel cache last bound
+ * to kernel in their place, so candidate launches don't touch the
+ * caller's buffers (a kernel that scales in place would otherwise be
+ * applied once per launch). Returns the number of arguments, with
+ * the originals in args and the copies in scratch for restoreArgs,
+ * or -1 with the kernel's own arguments left bound if a copy
+ * couldn't be made
+ */
+int bindScratchArgs(cl_kernel kernel, cl_command_queue queue, size_t** args, cl_mem** scratch) {
+    size_t count = 0;
+    *args = boundKernelArgs(kernel, &count);
+    if (*args == NULL) {
+        return -1;
+    }
+    *scratch = (cl_mem*) calloc(count, sizeof(cl_mem));
+    for (size_t i = 0; i < count; i++) {
+        (*scratch)[i] = scratchCopy(queue, (cl_mem) (*args)[i]);
+        if ((*scratch)[i] == NULL || clSetKernelArg(kernel, i, sizeof(cl_mem), &(*scratch)[i]) != CL_SUCCESS) {
+            restoreArgs(kernel, *args, *scratch, count);
+            return -1;
+        }
+    }
+    //the copies are in place before the first candidate is timed
+    clFinish(queue);
+    return (int) count;
+}
+
+/*
+ * Times the candidate local sizes for a launch and stores the
+ * fastest under key, and in best. A stored size of all zeros means
+ * the runtime's own choice won. Only the first two dimensions are
+ * tuned. Two threads may tune the same launch at once, the last to
+ * finish is kept. Returns 0, leaving nothing stored, if the kernel's
+ * arguments couldn't be copied to tune on
+ */
+uint8_t tuneWorkGroup(cl_kernel kernel, cl_command_queue queue, size_t dims, size_t* global, char* key, size_t* best) {
+    cl_device_id device = NULL;
+    size_t kernelMax = 0;
+    size_t itemMax[3] = {0, 0, 0};
+    clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &device, NULL);
+    clGetKernelWorkGroupInfo(kernel, device, CL_KERNEL_WORK_GROUP_SIZE, sizeof(size_t), &kernelMax, NULL);
+    clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_ITEM_SIZES, sizeof(itemMax), itemMax, NULL);
+
+    size_t* args = NULL;
+    cl_mem* scratch = NULL;
+    int argCount = bindScratchArgs(kernel, queue, &args, &scratch);
+    if (argCount < 0) {
+        return 0;
+    }
+
+    size_t candidate[3] = {1, 1, 1};
+    //untimed warm up, so the first candidate doesn't pay for it
+    timeLaunch(kernel, queue, dims, global, NULL);
+    uint64_t bestNs = timeLaunch(kernel, queue, dims, global, NULL);
+
+    size_t max1 = dims > 1 ? kernelMax : 1;
+    for (size_t l1 = 1; l1 <= max1 && (dims == 1 || l1 <= itemMax[1]); l1 <<= 1) {
+        if (dims > 1 && global[1] % l1 != 0) {
+            continue;
+        }
+        for (size_t l0 = 1; l0*l1 <= kernelMax && l0 <= itemMax[0]; l0 <<= 1) {
+            //groups of a handful of work-items are never the fastest
+            if (global[0] % l0 != 0 || l0*l1 < 16) {
+                continue;
+            }
+            candidate[0] = l0;
+            candidate[1] = l1;
+            uint64_t took = timeLaunch(kernel, queue, dims, global, candidate);
+            if (took < bestNs) {
+                bestNs = took;
+                best[0] = l0;
+                best[1] = dims > 1 ? l1 : 0;
+                best[2] = dims > 2 ? 1 : 0;
+            }
+        }
+    }
+    restoreArgs(kernel, args, scratch, argCount);
+    __atomic_fetch_add(&tuningsRun, 1, __ATOMIC_RELAXED);
+    pthread_mutex_lock(&tuningLock);
+    appendTuningFile(putTuning(key, best, dims));
+    pthread_mutex_unlock(&tuningLock);
+    return 1;
+}
+
+/*
+ * Fills local with the tuned local size for a launch that didn't
+ * give one, tuning first if that is on and allowed. Returns 0 if the
+ * runtime should choose
+ */
+uint8_t tunedLocalSize(cl_kernel kernel, cl_command_queue queue, size_t dims, size_t* global, size_t* local, uint8_t mayTune) {
+    if (dims == 0 || dims > 3 || (tuningTable == NULL && !tuningOn)) {
+        return 0;
+    }
+    char* key = workGroupKey(kernel, queue, dims, global);
+    //the entry is copied out, another thread may replace it
+    size_t tuned[3] = {0, 0, 0};
+    pthread_mutex_lock(&tuningLock);
+    TUNING_LI* entry = findTuning(key);
+    uint8_t found = entry != NULL && entry->count == dims;
+    if (found) {
+        memcpy(tuned, entry->values, sizeof(size_t)*dims);
+    }
+    pthread_mutex_unlock(&tuningLock);
+    if (entry == NULL && tuningOn && mayTune) {
+        found = tuneWorkGroup(kernel, queue, dims, global, key, tuned);
+    }
+    free(key);
+    if (!found || tuned[0] == 0) {
+        return 0;
+    }
+    //a hand edited tuning file may hold a size that doesn't divide the launch
+    for (size_t i = 0; i < dims; i++) {
+        if (tuned[i] == 0 || global[i] % tuned[i] != 0) {
+            return 0;
+        }
+    }
+    for (size_t i = 0; i < dims; i++) {
+        local[i] = tuned[i];
+    }
+    __atomic_fetch_add(&tunedLaunches, 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+/*
+ * Sets the file tuning results are loaded from and appended to,
+ * replacing the table with its entries. An empty path keeps results
+ * in memory only
+ */
+INSTRUCTION_DEF setTuningFile(FrameData* cframe) {
+    char* path = x_getParam_char_array(api, cframe, 0);
+    pthread_mutex_lock(&tuningLock);
+    free(tuningFile);
+    tuningFile = NULL;
+    clearTuning();
+    if (strlen(path) == 0) {
+        free(path);
+    }
+    else {
+        loadTuningFile(path);
+        tuningFile = path;
+    }
+    pthread_mutex_unlock(&tuningLock);
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF setAutotune(FrameData* cframe) {
+    tuningOn = api->getParamRaw(cframe, 0)[0] != 0;
+    return RETURN_OK;
+}
+
+INSTRUCTION_DEF getAutotune(FrameData* cframe) {
+    api->returnInt(cframe, (size_t) tuningOn);
+    return RETURN_OK;
+}
+
+/*
+ * Returns [launches given a tuned local size, launches tuned,
+ * candidates timed, entries in the table]
+ */
+INSTRUCTION_DEF getTuningStats(FrameData* cframe) {
+    size_t entries = 0;
+    pthread_mutex_lock(&tuningLock);
+    for (TUNING_LI* probe = tuningTable; probe != NULL; probe = probe->next) {
+        entries++;
     }
-    CL_err = clSetKernelArg(kernel, paramCount, sizeof(size_t), &paramCount);
+    pthread_mutex_unlock(&tuningLock);
+    DanaEl* returnArray = api->makeArray(intArrayGT, 4, NULL);
+    api->setArrayCellInt(returnArray, 0, tunedLaunches);
+    api->setArrayCellInt(returnArray, 1, tuningsRun);
+    api->setArrayCellInt(returnArray, 2, candidatesTimed);
+    api->setArrayCellInt(returnArray, 3, entries);
+
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
 
-    api->returnInt(cframe, (size_t) kernel);
-    free(rawParamArray);
+/*
+ * Returns the values stored under a caller's key, or null
+ */
+INSTRUCTION_DEF getTuning(FrameData* cframe) {
+    char* key = x_getParam_char_array(api, cframe, 0);
+    pthread_mutex_lock(&tuningLock);
+    TUNING_LI* entry = findTuning(key);
+    free(key);
+    if (entry == NULL) {
+        pthread_mutex_unlock(&tuningLock);
+        api->returnEl(cframe, NULL);
+        return RETURN_OK;
+    }
+    DanaEl* returnArray = api->makeArray(intArrayGT, entry->count, NULL);
+    for (size_t i = 0; i < entry->count; i++) {
+        api->setArrayCellInt(returnArray, i, entry->values[i]);
+    }
+    pthread_mutex_unlock(&tuningLock);
+    api->returnEl(cframe, returnArray);
+    return RETURN_OK;
+}
 
+INSTRUCTION_DEF storeTuning(FrameData* cframe) {
+    char* key = x_getParam_char_array(api, cframe, 0);
+    DanaEl* rawValues = api->getParamEl(cframe, 1);
+    size_t count = rawValues == NULL ? 0 : api->getArrayLength(rawValues);
+    if (count > TUNING_MAX_VALUES) {
+        count = TUNING_MAX_VALUES;
+    }
+    size_t values[TUNING_MAX_VALUES];
+    for (size_t i = 0; i < count; i++) {
+        values[i] = api->getArrayCellInt(rawValues, i);
+    }
+    //a key is the rest of its line in the tuning file
+    if (strlen(key) > 0 && strcspn(key, "\r\n") == strlen(key)) {
+        pthread_mutex_lock(&tuningLock);
+        appendTuningFile(putTuning(key, values, count));
+        pthread_mutex_unlock(&tuningLock);
+    }
+    free(key);
     return RETURN_OK;
+}
+
+/*
+ * Enqueues kernel with one work item per cell of the output
+ * vector/matrix of the kernel parameters, or the global size set on
+ * the Program. An empty (or null) local size takes the tuned size
+ * for the launch if there is one (tuning it first if mayTune), and
+ * otherwise leaves the work-group size up to the runtime
+ */
+cl_int enqueueKernel(cl_kernel kernel, cl_command_queue queue, DanaEl* rawOutputDimentions, DanaEl* rawLocalDimentions, cl_uint numWait, cl_event* waitList, cl_event* event, uint8_t mayTune) {
+    size_t rawArrLen = api->getArrayLength(rawOutputDimentions);
+    
+    size_t* globalWorkers = (size_t*) malloc(sizeof(size_t)*rawArrLen);
+    for(int i = 0; i < rawArrLen; i++) {
+        *(globalWorkers+i) = api->getArrayCellInt(rawOutputDimentions, i);
+    }
+
+    size_t* localWorkers = NULL;
+    if (rawLocalDimentions != NULL && api->getArrayLength(rawLocalDimentions) == rawArrLen) {
+        localWorkers = (size_t*) malloc(sizeof(size_t)*rawArrLen);
+        for(int i = 0; i < rawArrLen; i++) {
+            *(localWorkers+i) = api->getArrayCellInt(rawLocalDimentions, i);
+        }
+    }
+    else if (rawArrLen > 0) {
+        localWorkers = (size_t*) malloc(sizeof(size_t)*rawArrLen);
+        if (!tunedLocalSize(kernel, queue, rawArrLen, globalWorkers, localWorkers, mayTune)) {
+            free(localWorkers);
+            localWorkers = NULL;
+        }
+    }
 
+    cl_int CL_err = clEnqueueNDRangeKernel(queue, kernel, rawArrLen, NULL, globalWorkers, localWorkers, numWait, waitList, event);
+    free(globalWorkers);
+    free(localWorkers);
+    return CL_err;
 }
 
 INSTRUCTION_DEF runKernel(FrameData* cframe) {
@@ -980,42 +6618,90 @@ INSTRUCTION_DEF runKernel(FrameData* cframe) {
     rawParam = api->getParamInt(cframe, 1);
     cl_command_queue queue = (cl_command_queue) rawParam;
 
-    //create an amount of kernel threads that is
-    //equivilent to the size and shape of the output
-    //vector/matrix of the kernel parameters
     DanaEl* rawOutputDimentions = api->getParamEl(cframe, 2);
+    DanaEl* rawLocalDimentions = api->getParamEl(cframe, 3);
 
-    size_t rawArrLen = api->getArrayLength(rawOutputDimentions);
-    
-    size_t* globalWorkers = (size_t*) malloc(sizeof(size_t)*rawArrLen);
-    for(int i = 0; i < rawArrLen; i++) {
-        *(globalWorkers+i) = api->getArrayCellInt(rawOutputDimentions, i);
+    if (isHostQueue(queue)) {
+        api->returnInt(cframe, (size_t) runHostKernel(kernel, rawOutputDimentions, rawLocalDimentions));
+        return RETURN_OK;
     }
 
     //synchronisation handling
-    cl_event* kernel_event = (cl_event*) malloc(sizeof(cl_event));
+    cl_event kernel_event;
 
-    cl_int CL_err = CL_SUCCESS;
-    CL_err = clEnqueueNDRangeKernel(queue, kernel, rawArrLen, NULL, globalWorkers, NULL, 0, NULL, kernel_event);
+    cl_int CL_err = enqueueKernel(kernel, queue, rawOutputDimentions, rawLocalDimentions, 0, NULL, &kernel_event, 1);
     if (CL_err != CL_SUCCESS) {
-        addLog(newLogItem("clEnqueueNDRangeKernel", CL_err));
+        addLog("clEnqueueNDRangeKernel", CL_err, kernel);
         api->returnInt(cframe, (size_t) 1);
         return RETURN_OK;
     }
 
     //wait for kernel to execute before continuing
-    clWaitForEvents(1, kernel_event);
+    clWaitForEvents(1, &kernel_event);
+    recordKernelProfile(kernel, kernel_event);
 
     //clean up
-    clReleaseEvent(*kernel_event);
-    free(kernel_event);
-    free(globalWorkers);
-    clRetainKernel(kernel);
+    clReleaseEvent(kernel_event);
 
     api->returnInt(cframe, (size_t) 0);
     return RETURN_OK;
 }
 
+/*
+ * As runKernel, but waits for the given events before the kernel
+ * starts rather than waiting for the kernel to finish. Returns a
+ * DANA_EVENT handle for the launch, or 0 on failure. Tuned local
+ * sizes are used, but a launch is never tuned here, since the
+ * candidates would have to wait on the events. A host device launch
+ * has run by the time this returns
+ */
+INSTRUCTION_DEF runKernelAsync(FrameData* cframe) {
+    cl_kernel kernel = (cl_kernel) api->getParamInt(cframe, 0);
+    cl_command_queue queue = (cl_command_queue) api->getParamInt(cframe, 1);
+    DanaEl* rawOutputDimentions = api->getParamEl(cframe, 2);
+    DanaEl* rawLocalDimentions = api->getParamEl(cframe, 3);
+
+    if (isHostQueue(queue)) {
+        DANA_EVENT* ev = NULL;
+        if (runHostKernel(kernel, rawOutputDimentions, rawLocalDimentions) == 0) {
+            ev = newEvent(EVENT_KERNEL, NULL, NULL);
+        }
+        api->returnInt(cframe, (size_t) ev);
+        return RETURN_OK;
+    }
+
+    cl_uint numWait = 0;
+    cl_event* waitList = getWaitList(api->getParamEl(cframe, 4), &numWait);
+
+    cl_event kernel_event;
+    cl_int CL_err = enqueueKernel(kernel, queue, rawOutputDimentions, rawLocalDimentions, numWait, waitList, &kernel_event, 0);
+    free(waitList);
+    if (CL_err != CL_SUCCESS) {
+        addLog("clEnqueueNDRangeKernel", CL_err, kernel);
+        api->returnInt(cframe, (size_t) 0);
+        return RETURN_OK;
+    }
+    clFlush(queue);
+
+    size_t argCount = 0;
+    size_t* args = boundKernelArgs(kernel, &argCount);
+    for (size_t i = 0; i < argCount; i++) {
+        markBusy((cl_mem) args[i], kernel_event);
+    }
+    free(args);
+
+    DANA_EVENT* ev = newEvent(EVENT_KERNEL, kernel_event, NULL);
+    if (profilingOn) {
+        char name[256];
+        name[0] = '\0';
+        clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, sizeof(name), name, NULL);
+        profileEventAs(ev, name, 0, 0);
+    }
+
+    api->returnInt(cframe, (size_t) ev);
+    return RETURN_OK;
+}
+
 INSTRUCTION_DEF findPlatforms(void) {
     cl_int CL_err = CL_SUCCESS;
     cl_uint numPlatforms = 0;
@@ -1034,30 +6720,122 @@ INSTRUCTION_DEF findPlatforms(void) {
 
 Interface* load(CoreAPI* capi) {
     api = capi;
+    initLog();
+
+    char* envCacheDir = getenv(BINARY_CACHE_ENV);
+    if (envCacheDir != NULL && strlen(envCacheDir) > 0) {
+        binaryCacheDir = strdup(envCacheDir);
+        makeCacheDir(binaryCacheDir);
+    }
+
+    char* envDevices = getenv(VISIBLE_DEVICES_ENV);
+    if (envDevices != NULL && strlen(envDevices) > 0) {
+        visibleDevices = strdup(envDevices);
+        for (char* at = visibleDevices; *at != '\0'; at++) {
+            if (*at == ';') {
+                *at = '\n';
+            }
+        }
+    }
+
+    char* envProfile = getenv(PROFILE_ENV);
+    profilingOn = envProfile != NULL && strlen(envProfile) > 0 && strcmp(envProfile, "0") != 0;
+
+    char* envTuningFile = getenv(TUNING_FILE_ENV);
+    if (envTuningFile != NULL && strlen(envTuningFile) > 0) {
+        tuningFile = strdup(envTuningFile);
+        loadTuningFile(tuningFile);
+    }
 
     setInterfaceFunction("findPlatforms", findPlatforms);
     setInterfaceFunction("getComputeDeviceIDs", getComputeDeviceIDs);
     setInterfaceFunction("getComputeDevices", getComputeDevices);
+    setInterfaceFunction("getHostDeviceName", getHostDeviceName);
+    setInterfaceFunction("setVisibleDevices", setVisibleDevices);
+    setInterfaceFunction("getVisibleDevices", getVisibleDevices);
     setInterfaceFunction("init", init);
     setInterfaceFunction("createContext", createContext);
     setInterfaceFunction("createAsynchQueue", createAsynchQueue);
     setInterfaceFunction("createSynchQueue", createSynchQueue);
     setInterfaceFunction("createArray", createArray);
+    setInterfaceFunction("getDefaultAllocMode", getDefaultAllocMode);
+    setInterfaceFunction("getDeviceLimits", getDeviceLimits);
+    setInterfaceFunction("getTimestamp", getTimestamp);
+    setInterfaceFunction("getTransferStats", getTransferStats);
+    setInterfaceFunction("resetTransferStats", resetTransferStats);
+    setInterfaceFunction("setBulkMarshalling", setBulkMarshalling);
     setInterfaceFunction("writeIntArray", writeIntArray);
     setInterfaceFunction("readIntArray", readIntArray);
     setInterfaceFunction("writeFloatArray", writeFloatArray);
     setInterfaceFunction("readFloatArray", readFloatArray);
+    setInterfaceFunction("writeDoubleArray", writeDoubleArray);
+    setInterfaceFunction("writeHalfArray", writeHalfArray);
+    setInterfaceFunction("readDoubleArray", readDoubleArray);
+    setInterfaceFunction("readHalfArray", readHalfArray);
     setInterfaceFunction("createMatrix", createMatrix);
+    setInterfaceFunction("getMatrixRowPitch", getMatrixRowPitch);
+    setInterfaceFunction("createRowView", createRowView);
+    setInterfaceFunction("copyMatrixRegion", copyMatrixRegion);
     setInterfaceFunction("writeIntMatrix", writeIntMatrix);
     setInterfaceFunction("readIntMatrix", readIntMatrix);
     setInterfaceFunction("writeFloatMatrix", writeFloatMatrix);
     setInterfaceFunction("readFloatMatrix", readFloatMatrix);
+    setInterfaceFunction("writeDoubleMatrix", writeDoubleMatrix);
+    setInterfaceFunction("writeHalfMatrix", writeHalfMatrix);
+    setInterfaceFunction("readDoubleMatrix", readDoubleMatrix);
+    setInterfaceFunction("readHalfMatrix", readHalfMatrix);
     setInterfaceFunction("destroyMemoryArea", destroyMemoryArea);
+    setInterfaceFunction("getPoolStats", getPoolStats);
+    setInterfaceFunction("trimPool", trimPool);
+    setInterfaceFunction("setPoolLimit", setPoolLimit);
     setInterfaceFunction("createProgram", createProgram);
+    setInterfaceFunction("setBinaryCacheDir", setBinaryCacheDir);
+    setInterfaceFunction("getBinaryCacheStats", getBinaryCacheStats);
+    setInterfaceFunction("setTuningFile", setTuningFile);
+    setInterfaceFunction("setAutotune", setAutotune);
+    setInterfaceFunction("getAutotune", getAutotune);
+    setInterfaceFunction("getTuningStats", getTuningStats);
+    setInterfaceFunction("getTuning", getTuning);
+    setInterfaceFunction("storeTuning", storeTuning);
+    setInterfaceFunction("setProfiling", setProfiling);
+    setInterfaceFunction("getProfiling", getProfiling);
+    setInterfaceFunction("getProfileNames", getProfileNames);
+    setInterfaceFunction("getProfile", getProfile);
+    setInterfaceFunction("resetProfile", resetProfile);
     setInterfaceFunction("prepareKernel", prepareKernel);
     setInterfaceFunction("runKernel", runKernel);
+    setInterfaceFunction("runKernelAsync", runKernelAsync);
+    setInterfaceFunction("writeIntArrayAsync", writeIntArrayAsync);
+    setInterfaceFunction("writeFloatArrayAsync", writeFloatArrayAsync);
+    setInterfaceFunction("writeIntMatrixAsync", writeIntMatrixAsync);
+    setInterfaceFunction("writeFloatMatrixAsync", writeFloatMatrixAsync);
+    setInterfaceFunction("writeDoubleArrayAsync", writeDoubleArrayAsync);
+    setInterfaceFunction("writeHalfArrayAsync", writeHalfArrayAsync);
+    setInterfaceFunction("writeDoubleMatrixAsync", writeDoubleMatrixAsync);
+    setInterfaceFunction("writeHalfMatrixAsync", writeHalfMatrixAsync);
+    setInterfaceFunction("writeIntRangeAsync", writeIntRangeAsync);
+    setInterfaceFunction("writeDecRangeAsync", writeDecRangeAsync);
+    setInterfaceFunction("writeDecRowsAsync", writeDecRowsAsync);
+    setInterfaceFunction("readAsync", readAsync);
+    setInterfaceFunction("collectIntArray", collectIntArray);
+    setInterfaceFunction("collectFloatArray", collectFloatArray);
+    setInterfaceFunction("collectIntMatrix", collectIntMatrix);
+    setInterfaceFunction("collectFloatMatrix", collectFloatMatrix);
+    setInterfaceFunction("collectDoubleArray", collectDoubleArray);
+    setInterfaceFunction("collectHalfArray", collectHalfArray);
+    setInterfaceFunction("collectDoubleMatrix", collectDoubleMatrix);
+    setInterfaceFunction("collectHalfMatrix", collectHalfMatrix);
+    setInterfaceFunction("collectIntInto", collectIntInto);
+    setInterfaceFunction("collectDecInto", collectDecInto);
+    setInterfaceFunction("waitEvent", waitEvent);
+    setInterfaceFunction("getEventStatus", getEventStatus);
+    setInterfaceFunction("destroyEvent", destroyEvent);
+    setInterfaceFunction("getKernelCacheStats", getKernelCacheStats);
     setInterfaceFunction("createContextSpace", createContextSpace);
     setInterfaceFunction("printLogs", printLogs);
+    setInterfaceFunction("getLogEntries", getLogEntries);
+    setInterfaceFunction("getLogCalls", getLogCalls);
+    setInterfaceFunction("getLogCounts", getLogCounts);
     setInterfaceFunction("destroyContextSpace", destroyContextSpace);
     setInterfaceFunction("destroyProgram", destroyProgram);
     setInterfaceFunction("destroyQueue", destroyQueue);
@@ -1070,10 +6848,21 @@ Interface* load(CoreAPI* capi) {
     decArrayGT = api->resolveGlobalTypeMapping(getTypeDefinition("dec[]"));
     decMatrixGT = api->resolveGlobalTypeMapping(getTypeDefinition("dec[][]"));
 
+    probeLayouts();
+
     return getPublicInterface();
 }
 
 void unload() {
+    free(binaryCacheDir);
+    binaryCacheDir = NULL;
+    free(tuningFile);
+    tuningFile = NULL;
+    clearTuning();
+    clearProfiles();
+    stopHostPool();
+    free(visibleDevices);
+    visibleDevices = NULL;
     api->decrementGTRefCount(charArrayGT);
     api->decrementGTRefCount(stringArrayGT);
     api->decrementGTRefCount(stringItemGT);
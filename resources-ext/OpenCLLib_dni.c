@@ -89,6 +89,12 @@ static const DanaTypeField function_OpenCLLib_getComputeDeviceIDs_fields[] = {
 {(DanaType*) &int_array_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_getComputeDevices_fields[] = {
 {(DanaType*) &String_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getHostDeviceName_fields[] = {
+{(DanaType*) &char_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_setVisibleDevices_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getVisibleDevices_fields[] = {
+{(DanaType*) &char_array_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_createContext_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_array_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 24}};
@@ -102,27 +108,103 @@ static const DanaTypeField function_OpenCLLib_createArray_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
 {(DanaType*) &int_def, NULL, 0, 0, 24},
-{(DanaType*) &int_def, NULL, 0, 0, 32}};
+{(DanaType*) &int_def, NULL, 0, 0, 32},
+{(DanaType*) &int_def, NULL, 0, 0, 40}};
 static const DanaTypeField function_OpenCLLib_createMatrix_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
 {(DanaType*) &int_def, NULL, 0, 0, 24},
 {(DanaType*) &int_def, NULL, 0, 0, 32},
+{(DanaType*) &int_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 48},
+{(DanaType*) &int_def, NULL, 0, 0, 56}};
+static const DanaTypeField function_OpenCLLib_getMatrixRowPitch_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24}};
+static const DanaTypeField function_OpenCLLib_createRowView_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 32},
 {(DanaType*) &int_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_copyMatrixRegion_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 32},
+{(DanaType*) &int_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 48},
+{(DanaType*) &int_def, NULL, 0, 0, 56},
+{(DanaType*) &int_def, NULL, 0, 0, 64},
+{(DanaType*) &int_def, NULL, 0, 0, 72},
+{(DanaType*) &int_def, NULL, 0, 0, 80},
+{(DanaType*) &int_def, NULL, 0, 0, 88},
+{(DanaType*) &int_def, NULL, 0, 0, 96}};
+static const DanaTypeField function_OpenCLLib_getDefaultAllocMode_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8}};
+static const DanaTypeField function_OpenCLLib_getDeviceLimits_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_getTimestamp_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getTransferStats_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_resetTransferStats_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_setBulkMarshalling_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &bool_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_destroyMemoryArea_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0},
+{(DanaType*) &int_def, NULL, 0, 0, 8}};
+static const DanaTypeField function_OpenCLLib_getPoolStats_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_trimPool_fields[] = {
 {(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_setPoolLimit_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0},
+{(DanaType*) &int_def, NULL, 0, 0, 8}};
 static const DanaTypeField function_OpenCLLib_createProgram_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 8},
-{(DanaType*) &int_def, NULL, 0, 0, 24},
-{(DanaType*) &int_def, NULL, 0, 0, 32}};
+{(DanaType*) &char_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 48}};
+static const DanaTypeField function_OpenCLLib_setBinaryCacheDir_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getBinaryCacheStats_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_setTuningFile_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_setAutotune_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &bool_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getAutotune_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getTuningStats_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getTuning_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_storeTuning_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 0},
+{(DanaType*) &int_array_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_setProfiling_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &bool_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getProfiling_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getProfileNames_fields[] = {
+{(DanaType*) &String_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getProfile_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &char_array_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_resetProfile_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_writeIntArray_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
-{(DanaType*) &int_array_def, NULL, 0, 0, 24}};
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 40}};
 static const DanaTypeField function_OpenCLLib_readIntArray_fields[] = {
 {(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
 {(DanaType*) &int_def, NULL, 0, 0, 24},
-{(DanaType*) &int_def, NULL, 0, 0, 32}};
+{(DanaType*) &int_def, NULL, 0, 0, 32},
+{(DanaType*) &int_def, NULL, 0, 0, 40}};
 static const DanaTypeField function_OpenCLLib_writeFloatArray_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
@@ -134,11 +216,13 @@ static const DanaTypeField function_OpenCLLib_readFloatArray_fields[] = {
 static const DanaTypeField function_OpenCLLib_writeIntMatrix_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
-{(DanaType*) &int_a_array_def, NULL, 0, 0, 24}};
+{(DanaType*) &int_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 40}};
 static const DanaTypeField function_OpenCLLib_readIntMatrix_fields[] = {
 {(DanaType*) &int_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
 {(DanaType*) &int_def, NULL, 0, 0, 24},
-{(DanaType*) &int_array_def, NULL, 0, 0, 32}};
+{(DanaType*) &int_array_def, NULL, 0, 0, 32},
+{(DanaType*) &int_def, NULL, 0, 0, 48}};
 static const DanaTypeField function_OpenCLLib_writeFloatMatrix_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
@@ -147,15 +231,159 @@ static const DanaTypeField function_OpenCLLib_readFloatMatrix_fields[] = {
 {(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
 {(DanaType*) &int_def, NULL, 0, 0, 24},
 {(DanaType*) &int_array_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_writeDoubleArray_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24}};
+static const DanaTypeField function_OpenCLLib_readDoubleArray_fields[] = {
+{(DanaType*) &dec_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_writeDoubleMatrix_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24}};
+static const DanaTypeField function_OpenCLLib_readDoubleMatrix_fields[] = {
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_writeHalfArray_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24}};
+static const DanaTypeField function_OpenCLLib_readHalfArray_fields[] = {
+{(DanaType*) &dec_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_writeHalfMatrix_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24}};
+static const DanaTypeField function_OpenCLLib_readHalfMatrix_fields[] = {
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 32}};
 static const DanaTypeField function_OpenCLLib_prepareKernel_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
-{(DanaType*) &int_array_def, NULL, 0, 0, 16},
-{(DanaType*) &int_def, NULL, 0, 0, 32},
-{(DanaType*) &char_array_def, NULL, 0, 0, 40}};
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 40},
+{(DanaType*) &char_array_def, NULL, 0, 0, 48}};
 static const DanaTypeField function_OpenCLLib_runKernel_fields[] = {
 {(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
 {(DanaType*) &int_def, NULL, 0, 0, 16},
-{(DanaType*) &int_array_def, NULL, 0, 0, 24}};
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_runKernelAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_array_def, NULL, 0, 0, 56}};
+static const DanaTypeField function_OpenCLLib_writeIntArrayAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 56}};
+static const DanaTypeField function_OpenCLLib_writeFloatArrayAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeIntMatrixAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 56}};
+static const DanaTypeField function_OpenCLLib_writeFloatMatrixAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeDoubleArrayAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeDoubleMatrixAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeHalfArrayAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeHalfMatrixAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40}};
+static const DanaTypeField function_OpenCLLib_writeIntRangeAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 56},
+{(DanaType*) &int_def, NULL, 0, 0, 64},
+{(DanaType*) &int_def, NULL, 0, 0, 72}};
+static const DanaTypeField function_OpenCLLib_writeDecRangeAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 56},
+{(DanaType*) &int_def, NULL, 0, 0, 64},
+{(DanaType*) &int_def, NULL, 0, 0, 72}};
+static const DanaTypeField function_OpenCLLib_writeDecRowsAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_array_def, NULL, 0, 0, 40},
+{(DanaType*) &int_def, NULL, 0, 0, 56},
+{(DanaType*) &int_def, NULL, 0, 0, 64},
+{(DanaType*) &int_def, NULL, 0, 0, 72}};
+static const DanaTypeField function_OpenCLLib_readAsync_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_def, NULL, 0, 0, 16},
+{(DanaType*) &int_array_def, NULL, 0, 0, 24},
+{(DanaType*) &int_def, NULL, 0, 0, 40},
+{(DanaType*) &int_array_def, NULL, 0, 0, 48}};
+static const DanaTypeField function_OpenCLLib_collectIntArray_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectFloatArray_fields[] = {
+{(DanaType*) &dec_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectIntMatrix_fields[] = {
+{(DanaType*) &int_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectFloatMatrix_fields[] = {
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectDoubleArray_fields[] = {
+{(DanaType*) &dec_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectDoubleMatrix_fields[] = {
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectHalfArray_fields[] = {
+{(DanaType*) &dec_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectHalfMatrix_fields[] = {
+{(DanaType*) &dec_a_array_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 16}};
+static const DanaTypeField function_OpenCLLib_collectIntInto_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &int_array_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_collectDecInto_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8},
+{(DanaType*) &dec_array_def, NULL, 0, 0, 16},
+{(DanaType*) &int_def, NULL, 0, 0, 32}};
+static const DanaTypeField function_OpenCLLib_waitEvent_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8}};
+static const DanaTypeField function_OpenCLLib_getEventStatus_fields[] = {
+{(DanaType*) &int_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 8}};
+static const DanaTypeField function_OpenCLLib_destroyEvent_fields[] = {
+{(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getKernelCacheStats_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_destroyContextSpace_fields[] = {
 {(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_destroyQueue_fields[] = {
@@ -164,6 +392,12 @@ static const DanaTypeField function_OpenCLLib_destroyProgram_fields[] = {
 {(DanaType*) &void_def, NULL, 0, 0, 0},{(DanaType*) &int_def, NULL, 0, 0, 0}};
 static const DanaTypeField function_OpenCLLib_printLogs_fields[] = {
 {(DanaType*) &void_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getLogEntries_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getLogCalls_fields[] = {
+{(DanaType*) &String_array_def, NULL, 0, 0, 0}};
+static const DanaTypeField function_OpenCLLib_getLogCounts_fields[] = {
+{(DanaType*) &int_array_def, NULL, 0, 0, 0}};
 static const DanaType object_OpenCLLib_functions_spec[] = {
 {TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_clone_fields, 2},
 {TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_equals_fields, 2},
@@ -174,27 +408,93 @@ static const DanaType object_OpenCLLib_functions_spec[] = {
 {TYPE_FUNCTION, 0, 0, (DanaTypeField*) &function_OpenCLLib_findPlatforms_fields, 1},
 {TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getComputeDeviceIDs_fields, 1},
 {TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getComputeDevices_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getHostDeviceName_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_setVisibleDevices_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getVisibleDevices_fields, 1},
 {TYPE_FUNCTION, 0, 32, (DanaTypeField*) &function_OpenCLLib_createContext_fields, 3},
 {TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_createAsynchQueue_fields, 3},
 {TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_createSynchQueue_fields, 3},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_createArray_fields, 5},
-{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_createMatrix_fields, 6},
-{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_destroyMemoryArea_fields, 2},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_createProgram_fields, 4},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeIntArray_fields, 4},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_readIntArray_fields, 4},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_createArray_fields, 6},
+{TYPE_FUNCTION, 0, 64, (DanaTypeField*) &function_OpenCLLib_createMatrix_fields, 8},
+{TYPE_FUNCTION, 0, 32, (DanaTypeField*) &function_OpenCLLib_getMatrixRowPitch_fields, 4},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_createRowView_fields, 6},
+{TYPE_FUNCTION, 0, 104, (DanaTypeField*) &function_OpenCLLib_copyMatrixRegion_fields, 13},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getDefaultAllocMode_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_getDeviceLimits_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_getTimestamp_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getTransferStats_fields, 1},
+{TYPE_FUNCTION, 0, 0, (DanaTypeField*) &function_OpenCLLib_resetTransferStats_fields, 1},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_setBulkMarshalling_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_destroyMemoryArea_fields, 3},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_getPoolStats_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_trimPool_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_setPoolLimit_fields, 3},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_createProgram_fields, 5},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_setBinaryCacheDir_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getBinaryCacheStats_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_setTuningFile_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_setAutotune_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_getAutotune_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getTuningStats_fields, 1},
+{TYPE_FUNCTION, 0, 32, (DanaTypeField*) &function_OpenCLLib_getTuning_fields, 2},
+{TYPE_FUNCTION, 0, 32, (DanaTypeField*) &function_OpenCLLib_storeTuning_fields, 3},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_setProfiling_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_getProfiling_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getProfileNames_fields, 1},
+{TYPE_FUNCTION, 0, 32, (DanaTypeField*) &function_OpenCLLib_getProfile_fields, 2},
+{TYPE_FUNCTION, 0, 0, (DanaTypeField*) &function_OpenCLLib_resetProfile_fields, 1},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_writeIntArray_fields, 5},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_readIntArray_fields, 5},
 {TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeFloatArray_fields, 4},
 {TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_readFloatArray_fields, 4},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeIntMatrix_fields, 4},
-{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_readIntMatrix_fields, 4},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_writeIntMatrix_fields, 5},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_readIntMatrix_fields, 5},
 {TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeFloatMatrix_fields, 4},
 {TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_readFloatMatrix_fields, 4},
-{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_prepareKernel_fields, 5},
-{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_runKernel_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeDoubleArray_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_readDoubleArray_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeDoubleMatrix_fields, 4},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_readDoubleMatrix_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeHalfArray_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_readHalfArray_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_writeHalfMatrix_fields, 4},
+{TYPE_FUNCTION, 0, 48, (DanaTypeField*) &function_OpenCLLib_readHalfMatrix_fields, 4},
+{TYPE_FUNCTION, 0, 64, (DanaTypeField*) &function_OpenCLLib_prepareKernel_fields, 6},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_runKernel_fields, 5},
+{TYPE_FUNCTION, 0, 72, (DanaTypeField*) &function_OpenCLLib_runKernelAsync_fields, 6},
+{TYPE_FUNCTION, 0, 64, (DanaTypeField*) &function_OpenCLLib_writeIntArrayAsync_fields, 6},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeFloatArrayAsync_fields, 5},
+{TYPE_FUNCTION, 0, 64, (DanaTypeField*) &function_OpenCLLib_writeIntMatrixAsync_fields, 6},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeFloatMatrixAsync_fields, 5},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeDoubleArrayAsync_fields, 5},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeDoubleMatrixAsync_fields, 5},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeHalfArrayAsync_fields, 5},
+{TYPE_FUNCTION, 0, 56, (DanaTypeField*) &function_OpenCLLib_writeHalfMatrixAsync_fields, 5},
+{TYPE_FUNCTION, 0, 80, (DanaTypeField*) &function_OpenCLLib_writeIntRangeAsync_fields, 8},
+{TYPE_FUNCTION, 0, 80, (DanaTypeField*) &function_OpenCLLib_writeDecRangeAsync_fields, 8},
+{TYPE_FUNCTION, 0, 80, (DanaTypeField*) &function_OpenCLLib_writeDecRowsAsync_fields, 8},
+{TYPE_FUNCTION, 0, 64, (DanaTypeField*) &function_OpenCLLib_readAsync_fields, 6},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectIntArray_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectFloatArray_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectIntMatrix_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectFloatMatrix_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectDoubleArray_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectDoubleMatrix_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectHalfArray_fields, 2},
+{TYPE_FUNCTION, 0, 24, (DanaTypeField*) &function_OpenCLLib_collectHalfMatrix_fields, 2},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_collectIntInto_fields, 4},
+{TYPE_FUNCTION, 0, 40, (DanaTypeField*) &function_OpenCLLib_collectDecInto_fields, 4},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_waitEvent_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getEventStatus_fields, 2},
+{TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_destroyEvent_fields, 2},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getKernelCacheStats_fields, 1},
 {TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_destroyContextSpace_fields, 2},
 {TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_destroyQueue_fields, 2},
 {TYPE_FUNCTION, 0, 8, (DanaTypeField*) &function_OpenCLLib_destroyProgram_fields, 2},
-{TYPE_FUNCTION, 0, 0, (DanaTypeField*) &function_OpenCLLib_printLogs_fields, 1}};
+{TYPE_FUNCTION, 0, 0, (DanaTypeField*) &function_OpenCLLib_printLogs_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getLogEntries_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getLogCalls_fields, 1},
+{TYPE_FUNCTION, 0, 16, (DanaTypeField*) &function_OpenCLLib_getLogCounts_fields, 1}};
 static const DanaTypeField intf_functions_def[] = {
 {(DanaType*) &object_OpenCLLib_functions_spec[0], "clone", 5},
 {(DanaType*) &object_OpenCLLib_functions_spec[1], "equals", 6},
@@ -205,31 +505,97 @@ static const DanaTypeField intf_functions_def[] = {
 {(DanaType*) &object_OpenCLLib_functions_spec[6], "findPlatforms", 13},
 {(DanaType*) &object_OpenCLLib_functions_spec[7], "getComputeDeviceIDs", 19},
 {(DanaType*) &object_OpenCLLib_functions_spec[8], "getComputeDevices", 17},
-{(DanaType*) &object_OpenCLLib_functions_spec[9], "createContext", 13},
-{(DanaType*) &object_OpenCLLib_functions_spec[10], "createAsynchQueue", 17},
-{(DanaType*) &object_OpenCLLib_functions_spec[11], "createSynchQueue", 16},
-{(DanaType*) &object_OpenCLLib_functions_spec[12], "createArray", 11},
-{(DanaType*) &object_OpenCLLib_functions_spec[13], "createMatrix", 12},
-{(DanaType*) &object_OpenCLLib_functions_spec[14], "destroyMemoryArea", 17},
-{(DanaType*) &object_OpenCLLib_functions_spec[15], "createProgram", 13},
-{(DanaType*) &object_OpenCLLib_functions_spec[16], "writeIntArray", 13},
-{(DanaType*) &object_OpenCLLib_functions_spec[17], "readIntArray", 12},
-{(DanaType*) &object_OpenCLLib_functions_spec[18], "writeFloatArray", 15},
-{(DanaType*) &object_OpenCLLib_functions_spec[19], "readFloatArray", 14},
-{(DanaType*) &object_OpenCLLib_functions_spec[20], "writeIntMatrix", 14},
-{(DanaType*) &object_OpenCLLib_functions_spec[21], "readIntMatrix", 13},
-{(DanaType*) &object_OpenCLLib_functions_spec[22], "writeFloatMatrix", 16},
-{(DanaType*) &object_OpenCLLib_functions_spec[23], "readFloatMatrix", 15},
-{(DanaType*) &object_OpenCLLib_functions_spec[24], "prepareKernel", 13},
-{(DanaType*) &object_OpenCLLib_functions_spec[25], "runKernel", 9},
-{(DanaType*) &object_OpenCLLib_functions_spec[26], "destroyContextSpace", 19},
-{(DanaType*) &object_OpenCLLib_functions_spec[27], "destroyQueue", 12},
-{(DanaType*) &object_OpenCLLib_functions_spec[28], "destroyProgram", 14},
-{(DanaType*) &object_OpenCLLib_functions_spec[29], "printLogs", 9}};
+{(DanaType*) &object_OpenCLLib_functions_spec[9], "getHostDeviceName", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[10], "setVisibleDevices", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[11], "getVisibleDevices", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[12], "createContext", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[13], "createAsynchQueue", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[14], "createSynchQueue", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[15], "createArray", 11},
+{(DanaType*) &object_OpenCLLib_functions_spec[16], "createMatrix", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[17], "getMatrixRowPitch", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[18], "createRowView", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[19], "copyMatrixRegion", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[20], "getDefaultAllocMode", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[21], "getDeviceLimits", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[22], "getTimestamp", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[23], "getTransferStats", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[24], "resetTransferStats", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[25], "setBulkMarshalling", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[26], "destroyMemoryArea", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[27], "getPoolStats", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[28], "trimPool", 8},
+{(DanaType*) &object_OpenCLLib_functions_spec[29], "setPoolLimit", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[30], "createProgram", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[31], "setBinaryCacheDir", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[32], "getBinaryCacheStats", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[33], "setTuningFile", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[34], "setAutotune", 11},
+{(DanaType*) &object_OpenCLLib_functions_spec[35], "getAutotune", 11},
+{(DanaType*) &object_OpenCLLib_functions_spec[36], "getTuningStats", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[37], "getTuning", 9},
+{(DanaType*) &object_OpenCLLib_functions_spec[38], "storeTuning", 11},
+{(DanaType*) &object_OpenCLLib_functions_spec[39], "setProfiling", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[40], "getProfiling", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[41], "getProfileNames", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[42], "getProfile", 10},
+{(DanaType*) &object_OpenCLLib_functions_spec[43], "resetProfile", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[44], "writeIntArray", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[45], "readIntArray", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[46], "writeFloatArray", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[47], "readFloatArray", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[48], "writeIntMatrix", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[49], "readIntMatrix", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[50], "writeFloatMatrix", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[51], "readFloatMatrix", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[52], "writeDoubleArray", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[53], "readDoubleArray", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[54], "writeDoubleMatrix", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[55], "readDoubleMatrix", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[56], "writeHalfArray", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[57], "readHalfArray", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[58], "writeHalfMatrix", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[59], "readHalfMatrix", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[60], "prepareKernel", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[61], "runKernel", 9},
+{(DanaType*) &object_OpenCLLib_functions_spec[62], "runKernelAsync", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[63], "writeIntArrayAsync", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[64], "writeFloatArrayAsync", 20},
+{(DanaType*) &object_OpenCLLib_functions_spec[65], "writeIntMatrixAsync", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[66], "writeFloatMatrixAsync", 21},
+{(DanaType*) &object_OpenCLLib_functions_spec[67], "writeDoubleArrayAsync", 21},
+{(DanaType*) &object_OpenCLLib_functions_spec[68], "writeDoubleMatrixAsync", 22},
+{(DanaType*) &object_OpenCLLib_functions_spec[69], "writeHalfArrayAsync", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[70], "writeHalfMatrixAsync", 20},
+{(DanaType*) &object_OpenCLLib_functions_spec[71], "writeIntRangeAsync", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[72], "writeDecRangeAsync", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[73], "writeDecRowsAsync", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[74], "readAsync", 9},
+{(DanaType*) &object_OpenCLLib_functions_spec[75], "collectIntArray", 15},
+{(DanaType*) &object_OpenCLLib_functions_spec[76], "collectFloatArray", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[77], "collectIntMatrix", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[78], "collectFloatMatrix", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[79], "collectDoubleArray", 18},
+{(DanaType*) &object_OpenCLLib_functions_spec[80], "collectDoubleMatrix", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[81], "collectHalfArray", 16},
+{(DanaType*) &object_OpenCLLib_functions_spec[82], "collectHalfMatrix", 17},
+{(DanaType*) &object_OpenCLLib_functions_spec[83], "collectIntInto", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[84], "collectDecInto", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[85], "waitEvent", 9},
+{(DanaType*) &object_OpenCLLib_functions_spec[86], "getEventStatus", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[87], "destroyEvent", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[88], "getKernelCacheStats", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[89], "destroyContextSpace", 19},
+{(DanaType*) &object_OpenCLLib_functions_spec[90], "destroyQueue", 12},
+{(DanaType*) &object_OpenCLLib_functions_spec[91], "destroyProgram", 14},
+{(DanaType*) &object_OpenCLLib_functions_spec[92], "printLogs", 9},
+{(DanaType*) &object_OpenCLLib_functions_spec[93], "getLogEntries", 13},
+{(DanaType*) &object_OpenCLLib_functions_spec[94], "getLogCalls", 11},
+{(DanaType*) &object_OpenCLLib_functions_spec[95], "getLogCounts", 12}};
 static const DanaTypeField intf_events_def[] = {
 };
 static const DanaType OpenCLLib_object_spec[] = {
-{TYPE_DATA, 0, 0, (DanaTypeField*) intf_functions_def, 30},
+{TYPE_DATA, 0, 0, (DanaTypeField*) intf_functions_def, 96},
 {TYPE_DATA, 0, 0, (DanaTypeField*) intf_events_def, 0},
 {TYPE_DATA, 0, 0, NULL, 0}
 };
@@ -247,13 +613,41 @@ static unsigned char op_createContextSpace_thread_spec[sizeof(VFrameHeader)+size
 static unsigned char op_findPlatforms_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_getComputeDeviceIDs_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_getComputeDevices_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getHostDeviceName_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setVisibleDevices_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getVisibleDevices_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createContext_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createAsynchQueue_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createSynchQueue_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getMatrixRowPitch_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_createRowView_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_copyMatrixRegion_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getDefaultAllocMode_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getDeviceLimits_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getTimestamp_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getTransferStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_resetTransferStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setBulkMarshalling_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_destroyMemoryArea_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getPoolStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_trimPool_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setPoolLimit_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_createProgram_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setBinaryCacheDir_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getBinaryCacheStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setTuningFile_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setAutotune_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getAutotune_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getTuningStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getTuning_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_storeTuning_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_setProfiling_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getProfiling_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getProfileNames_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getProfile_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_resetProfile_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_writeIntArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_readIntArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_writeFloatArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
@@ -262,12 +656,50 @@ static unsigned char op_writeIntMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(V
 static unsigned char op_readIntMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_writeFloatMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_readFloatMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDoubleArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_readDoubleArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDoubleMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_readDoubleMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeHalfArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_readHalfArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeHalfMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_readHalfMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_prepareKernel_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_runKernel_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_runKernelAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeIntArrayAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeFloatArrayAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeIntMatrixAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeFloatMatrixAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDoubleArrayAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDoubleMatrixAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeHalfArrayAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeHalfMatrixAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeIntRangeAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDecRangeAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_writeDecRowsAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_readAsync_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectIntArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectFloatArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectIntMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectFloatMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectDoubleArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectDoubleMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectHalfArray_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectHalfMatrix_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectIntInto_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_collectDecInto_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_waitEvent_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getEventStatus_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_destroyEvent_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getKernelCacheStats_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_destroyContextSpace_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_destroyQueue_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_destroyProgram_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static unsigned char op_printLogs_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getLogEntries_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getLogCalls_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
+static unsigned char op_getLogCounts_thread_spec[sizeof(VFrameHeader)+sizeof(VFrame)];
 static SourceHeader header;
 static DanaComponent self;
 static size_t interfaceFunctions[] = {
@@ -280,13 +712,41 @@ static size_t interfaceFunctions[] = {
 (size_t) op_findPlatforms_thread_spec,
 (size_t) op_getComputeDeviceIDs_thread_spec,
 (size_t) op_getComputeDevices_thread_spec,
+(size_t) op_getHostDeviceName_thread_spec,
+(size_t) op_setVisibleDevices_thread_spec,
+(size_t) op_getVisibleDevices_thread_spec,
 (size_t) op_createContext_thread_spec,
 (size_t) op_createAsynchQueue_thread_spec,
 (size_t) op_createSynchQueue_thread_spec,
 (size_t) op_createArray_thread_spec,
 (size_t) op_createMatrix_thread_spec,
+(size_t) op_getMatrixRowPitch_thread_spec,
+(size_t) op_createRowView_thread_spec,
+(size_t) op_copyMatrixRegion_thread_spec,
+(size_t) op_getDefaultAllocMode_thread_spec,
+(size_t) op_getDeviceLimits_thread_spec,
+(size_t) op_getTimestamp_thread_spec,
+(size_t) op_getTransferStats_thread_spec,
+(size_t) op_resetTransferStats_thread_spec,
+(size_t) op_setBulkMarshalling_thread_spec,
 (size_t) op_destroyMemoryArea_thread_spec,
+(size_t) op_getPoolStats_thread_spec,
+(size_t) op_trimPool_thread_spec,
+(size_t) op_setPoolLimit_thread_spec,
 (size_t) op_createProgram_thread_spec,
+(size_t) op_setBinaryCacheDir_thread_spec,
+(size_t) op_getBinaryCacheStats_thread_spec,
+(size_t) op_setTuningFile_thread_spec,
+(size_t) op_setAutotune_thread_spec,
+(size_t) op_getAutotune_thread_spec,
+(size_t) op_getTuningStats_thread_spec,
+(size_t) op_getTuning_thread_spec,
+(size_t) op_storeTuning_thread_spec,
+(size_t) op_setProfiling_thread_spec,
+(size_t) op_getProfiling_thread_spec,
+(size_t) op_getProfileNames_thread_spec,
+(size_t) op_getProfile_thread_spec,
+(size_t) op_resetProfile_thread_spec,
 (size_t) op_writeIntArray_thread_spec,
 (size_t) op_readIntArray_thread_spec,
 (size_t) op_writeFloatArray_thread_spec,
@@ -295,12 +755,50 @@ static size_t interfaceFunctions[] = {
 (size_t) op_readIntMatrix_thread_spec,
 (size_t) op_writeFloatMatrix_thread_spec,
 (size_t) op_readFloatMatrix_thread_spec,
+(size_t) op_writeDoubleArray_thread_spec,
+(size_t) op_readDoubleArray_thread_spec,
+(size_t) op_writeDoubleMatrix_thread_spec,
+(size_t) op_readDoubleMatrix_thread_spec,
+(size_t) op_writeHalfArray_thread_spec,
+(size_t) op_readHalfArray_thread_spec,
+(size_t) op_writeHalfMatrix_thread_spec,
+(size_t) op_readHalfMatrix_thread_spec,
 (size_t) op_prepareKernel_thread_spec,
 (size_t) op_runKernel_thread_spec,
+(size_t) op_runKernelAsync_thread_spec,
+(size_t) op_writeIntArrayAsync_thread_spec,
+(size_t) op_writeFloatArrayAsync_thread_spec,
+(size_t) op_writeIntMatrixAsync_thread_spec,
+(size_t) op_writeFloatMatrixAsync_thread_spec,
+(size_t) op_writeDoubleArrayAsync_thread_spec,
+(size_t) op_writeDoubleMatrixAsync_thread_spec,
+(size_t) op_writeHalfArrayAsync_thread_spec,
+(size_t) op_writeHalfMatrixAsync_thread_spec,
+(size_t) op_writeIntRangeAsync_thread_spec,
+(size_t) op_writeDecRangeAsync_thread_spec,
+(size_t) op_writeDecRowsAsync_thread_spec,
+(size_t) op_readAsync_thread_spec,
+(size_t) op_collectIntArray_thread_spec,
+(size_t) op_collectFloatArray_thread_spec,
+(size_t) op_collectIntMatrix_thread_spec,
+(size_t) op_collectFloatMatrix_thread_spec,
+(size_t) op_collectDoubleArray_thread_spec,
+(size_t) op_collectDoubleMatrix_thread_spec,
+(size_t) op_collectHalfArray_thread_spec,
+(size_t) op_collectHalfMatrix_thread_spec,
+(size_t) op_collectIntInto_thread_spec,
+(size_t) op_collectDecInto_thread_spec,
+(size_t) op_waitEvent_thread_spec,
+(size_t) op_getEventStatus_thread_spec,
+(size_t) op_destroyEvent_thread_spec,
+(size_t) op_getKernelCacheStats_thread_spec,
 (size_t) op_destroyContextSpace_thread_spec,
 (size_t) op_destroyQueue_thread_spec,
 (size_t) op_destroyProgram_thread_spec,
-(size_t) op_printLogs_thread_spec};
+(size_t) op_printLogs_thread_spec,
+(size_t) op_getLogEntries_thread_spec,
+(size_t) op_getLogCalls_thread_spec,
+(size_t) op_getLogCounts_thread_spec};
 static DanaType libType = {TYPE_OBJECT, 0, 0, (DanaTypeField*) intf_def, 3};
 static InterfaceDetails ids[] = {{"OpenCLLib", 9, &libType}};
 static Interface objectInterfaces[] = {{&ids[0], {&self, NULL, NULL, interfaceFunctions, NULL, NULL}}		};
@@ -351,111 +849,441 @@ Interface* getPublicInterface(){
 ((VFrameHeader*) op_getComputeDevices_thread_spec) -> sub = NULL;
 ((VFrameHeader*) op_getComputeDevices_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[8];
 ((VFrameHeader*) op_getComputeDevices_thread_spec) -> functionName = "getComputeDevices";
+((VFrameHeader*) op_getHostDeviceName_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getHostDeviceName_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getHostDeviceName_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getHostDeviceName_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[9];
+((VFrameHeader*) op_getHostDeviceName_thread_spec) -> functionName = "getHostDeviceName";
+((VFrameHeader*) op_setVisibleDevices_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_setVisibleDevices_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setVisibleDevices_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setVisibleDevices_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[10];
+((VFrameHeader*) op_setVisibleDevices_thread_spec) -> functionName = "setVisibleDevices";
+((VFrameHeader*) op_getVisibleDevices_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getVisibleDevices_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getVisibleDevices_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getVisibleDevices_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[11];
+((VFrameHeader*) op_getVisibleDevices_thread_spec) -> functionName = "getVisibleDevices";
 ((VFrameHeader*) op_createContext_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 32;
 ((VFrameHeader*) op_createContext_thread_spec) -> formalParamsCount = 2;
 ((VFrameHeader*) op_createContext_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createContext_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[9];
+((VFrameHeader*) op_createContext_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[12];
 ((VFrameHeader*) op_createContext_thread_spec) -> functionName = "createContext";
 ((VFrameHeader*) op_createAsynchQueue_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
 ((VFrameHeader*) op_createAsynchQueue_thread_spec) -> formalParamsCount = 2;
 ((VFrameHeader*) op_createAsynchQueue_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createAsynchQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[10];
+((VFrameHeader*) op_createAsynchQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[13];
 ((VFrameHeader*) op_createAsynchQueue_thread_spec) -> functionName = "createAsynchQueue";
 ((VFrameHeader*) op_createSynchQueue_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
 ((VFrameHeader*) op_createSynchQueue_thread_spec) -> formalParamsCount = 2;
 ((VFrameHeader*) op_createSynchQueue_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createSynchQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[11];
+((VFrameHeader*) op_createSynchQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[14];
 ((VFrameHeader*) op_createSynchQueue_thread_spec) -> functionName = "createSynchQueue";
-((VFrameHeader*) op_createArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_createArray_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_createArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_createArray_thread_spec) -> formalParamsCount = 5;
 ((VFrameHeader*) op_createArray_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[12];
+((VFrameHeader*) op_createArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[15];
 ((VFrameHeader*) op_createArray_thread_spec) -> functionName = "createArray";
-((VFrameHeader*) op_createMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
-((VFrameHeader*) op_createMatrix_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_createMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 64;
+((VFrameHeader*) op_createMatrix_thread_spec) -> formalParamsCount = 7;
 ((VFrameHeader*) op_createMatrix_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[13];
+((VFrameHeader*) op_createMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[16];
 ((VFrameHeader*) op_createMatrix_thread_spec) -> functionName = "createMatrix";
-((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
-((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getMatrixRowPitch_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 32;
+((VFrameHeader*) op_getMatrixRowPitch_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_getMatrixRowPitch_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getMatrixRowPitch_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[17];
+((VFrameHeader*) op_getMatrixRowPitch_thread_spec) -> functionName = "getMatrixRowPitch";
+((VFrameHeader*) op_createRowView_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_createRowView_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_createRowView_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_createRowView_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[18];
+((VFrameHeader*) op_createRowView_thread_spec) -> functionName = "createRowView";
+((VFrameHeader*) op_copyMatrixRegion_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 104;
+((VFrameHeader*) op_copyMatrixRegion_thread_spec) -> formalParamsCount = 12;
+((VFrameHeader*) op_copyMatrixRegion_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_copyMatrixRegion_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[19];
+((VFrameHeader*) op_copyMatrixRegion_thread_spec) -> functionName = "copyMatrixRegion";
+((VFrameHeader*) op_getDefaultAllocMode_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getDefaultAllocMode_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getDefaultAllocMode_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getDefaultAllocMode_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[20];
+((VFrameHeader*) op_getDefaultAllocMode_thread_spec) -> functionName = "getDefaultAllocMode";
+((VFrameHeader*) op_getDeviceLimits_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_getDeviceLimits_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getDeviceLimits_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getDeviceLimits_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[21];
+((VFrameHeader*) op_getDeviceLimits_thread_spec) -> functionName = "getDeviceLimits";
+((VFrameHeader*) op_getTimestamp_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_getTimestamp_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getTimestamp_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getTimestamp_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[22];
+((VFrameHeader*) op_getTimestamp_thread_spec) -> functionName = "getTimestamp";
+((VFrameHeader*) op_getTransferStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getTransferStats_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getTransferStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getTransferStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[23];
+((VFrameHeader*) op_getTransferStats_thread_spec) -> functionName = "getTransferStats";
+((VFrameHeader*) op_resetTransferStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 0;
+((VFrameHeader*) op_resetTransferStats_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_resetTransferStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_resetTransferStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[24];
+((VFrameHeader*) op_resetTransferStats_thread_spec) -> functionName = "resetTransferStats";
+((VFrameHeader*) op_setBulkMarshalling_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_setBulkMarshalling_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setBulkMarshalling_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setBulkMarshalling_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[25];
+((VFrameHeader*) op_setBulkMarshalling_thread_spec) -> functionName = "setBulkMarshalling";
+((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> formalParamsCount = 2;
 ((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[14];
+((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[26];
 ((VFrameHeader*) op_destroyMemoryArea_thread_spec) -> functionName = "destroyMemoryArea";
-((VFrameHeader*) op_createProgram_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_createProgram_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_getPoolStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_getPoolStats_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getPoolStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getPoolStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[27];
+((VFrameHeader*) op_getPoolStats_thread_spec) -> functionName = "getPoolStats";
+((VFrameHeader*) op_trimPool_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_trimPool_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_trimPool_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_trimPool_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[28];
+((VFrameHeader*) op_trimPool_thread_spec) -> functionName = "trimPool";
+((VFrameHeader*) op_setPoolLimit_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_setPoolLimit_thread_spec) -> formalParamsCount = 2;
+((VFrameHeader*) op_setPoolLimit_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setPoolLimit_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[29];
+((VFrameHeader*) op_setPoolLimit_thread_spec) -> functionName = "setPoolLimit";
+((VFrameHeader*) op_createProgram_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_createProgram_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_createProgram_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_createProgram_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[15];
+((VFrameHeader*) op_createProgram_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[30];
 ((VFrameHeader*) op_createProgram_thread_spec) -> functionName = "createProgram";
-((VFrameHeader*) op_writeIntArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_writeIntArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_setBinaryCacheDir_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_setBinaryCacheDir_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setBinaryCacheDir_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setBinaryCacheDir_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[31];
+((VFrameHeader*) op_setBinaryCacheDir_thread_spec) -> functionName = "setBinaryCacheDir";
+((VFrameHeader*) op_getBinaryCacheStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getBinaryCacheStats_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getBinaryCacheStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getBinaryCacheStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[32];
+((VFrameHeader*) op_getBinaryCacheStats_thread_spec) -> functionName = "getBinaryCacheStats";
+((VFrameHeader*) op_setTuningFile_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_setTuningFile_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setTuningFile_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setTuningFile_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[33];
+((VFrameHeader*) op_setTuningFile_thread_spec) -> functionName = "setTuningFile";
+((VFrameHeader*) op_setAutotune_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_setAutotune_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setAutotune_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setAutotune_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[34];
+((VFrameHeader*) op_setAutotune_thread_spec) -> functionName = "setAutotune";
+((VFrameHeader*) op_getAutotune_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_getAutotune_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getAutotune_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getAutotune_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[35];
+((VFrameHeader*) op_getAutotune_thread_spec) -> functionName = "getAutotune";
+((VFrameHeader*) op_getTuningStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getTuningStats_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getTuningStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getTuningStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[36];
+((VFrameHeader*) op_getTuningStats_thread_spec) -> functionName = "getTuningStats";
+((VFrameHeader*) op_getTuning_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 32;
+((VFrameHeader*) op_getTuning_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getTuning_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getTuning_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[37];
+((VFrameHeader*) op_getTuning_thread_spec) -> functionName = "getTuning";
+((VFrameHeader*) op_storeTuning_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 32;
+((VFrameHeader*) op_storeTuning_thread_spec) -> formalParamsCount = 2;
+((VFrameHeader*) op_storeTuning_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_storeTuning_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[38];
+((VFrameHeader*) op_storeTuning_thread_spec) -> functionName = "storeTuning";
+((VFrameHeader*) op_setProfiling_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_setProfiling_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_setProfiling_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_setProfiling_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[39];
+((VFrameHeader*) op_setProfiling_thread_spec) -> functionName = "setProfiling";
+((VFrameHeader*) op_getProfiling_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_getProfiling_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getProfiling_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getProfiling_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[40];
+((VFrameHeader*) op_getProfiling_thread_spec) -> functionName = "getProfiling";
+((VFrameHeader*) op_getProfileNames_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getProfileNames_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getProfileNames_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getProfileNames_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[41];
+((VFrameHeader*) op_getProfileNames_thread_spec) -> functionName = "getProfileNames";
+((VFrameHeader*) op_getProfile_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 32;
+((VFrameHeader*) op_getProfile_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getProfile_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getProfile_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[42];
+((VFrameHeader*) op_getProfile_thread_spec) -> functionName = "getProfile";
+((VFrameHeader*) op_resetProfile_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 0;
+((VFrameHeader*) op_resetProfile_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_resetProfile_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_resetProfile_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[43];
+((VFrameHeader*) op_resetProfile_thread_spec) -> functionName = "resetProfile";
+((VFrameHeader*) op_writeIntArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_writeIntArray_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_writeIntArray_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_writeIntArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[16];
+((VFrameHeader*) op_writeIntArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[44];
 ((VFrameHeader*) op_writeIntArray_thread_spec) -> functionName = "writeIntArray";
-((VFrameHeader*) op_readIntArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_readIntArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readIntArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_readIntArray_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_readIntArray_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_readIntArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[17];
+((VFrameHeader*) op_readIntArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[45];
 ((VFrameHeader*) op_readIntArray_thread_spec) -> functionName = "readIntArray";
 ((VFrameHeader*) op_writeFloatArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
 ((VFrameHeader*) op_writeFloatArray_thread_spec) -> formalParamsCount = 3;
 ((VFrameHeader*) op_writeFloatArray_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_writeFloatArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[18];
+((VFrameHeader*) op_writeFloatArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[46];
 ((VFrameHeader*) op_writeFloatArray_thread_spec) -> functionName = "writeFloatArray";
 ((VFrameHeader*) op_readFloatArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
 ((VFrameHeader*) op_readFloatArray_thread_spec) -> formalParamsCount = 3;
 ((VFrameHeader*) op_readFloatArray_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_readFloatArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[19];
+((VFrameHeader*) op_readFloatArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[47];
 ((VFrameHeader*) op_readFloatArray_thread_spec) -> functionName = "readFloatArray";
-((VFrameHeader*) op_writeIntMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_writeIntMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_writeIntMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_writeIntMatrix_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_writeIntMatrix_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_writeIntMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[20];
+((VFrameHeader*) op_writeIntMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[48];
 ((VFrameHeader*) op_writeIntMatrix_thread_spec) -> functionName = "writeIntMatrix";
-((VFrameHeader*) op_readIntMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
-((VFrameHeader*) op_readIntMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readIntMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_readIntMatrix_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_readIntMatrix_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_readIntMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[21];
+((VFrameHeader*) op_readIntMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[49];
 ((VFrameHeader*) op_readIntMatrix_thread_spec) -> functionName = "readIntMatrix";
 ((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
 ((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> formalParamsCount = 3;
 ((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[22];
+((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[50];
 ((VFrameHeader*) op_writeFloatMatrix_thread_spec) -> functionName = "writeFloatMatrix";
 ((VFrameHeader*) op_readFloatMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
 ((VFrameHeader*) op_readFloatMatrix_thread_spec) -> formalParamsCount = 3;
 ((VFrameHeader*) op_readFloatMatrix_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_readFloatMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[23];
+((VFrameHeader*) op_readFloatMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[51];
 ((VFrameHeader*) op_readFloatMatrix_thread_spec) -> functionName = "readFloatMatrix";
-((VFrameHeader*) op_prepareKernel_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
-((VFrameHeader*) op_prepareKernel_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeDoubleArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_writeDoubleArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_writeDoubleArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDoubleArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[52];
+((VFrameHeader*) op_writeDoubleArray_thread_spec) -> functionName = "writeDoubleArray";
+((VFrameHeader*) op_readDoubleArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_readDoubleArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readDoubleArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_readDoubleArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[53];
+((VFrameHeader*) op_readDoubleArray_thread_spec) -> functionName = "readDoubleArray";
+((VFrameHeader*) op_writeDoubleMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_writeDoubleMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_writeDoubleMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDoubleMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[54];
+((VFrameHeader*) op_writeDoubleMatrix_thread_spec) -> functionName = "writeDoubleMatrix";
+((VFrameHeader*) op_readDoubleMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_readDoubleMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readDoubleMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_readDoubleMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[55];
+((VFrameHeader*) op_readDoubleMatrix_thread_spec) -> functionName = "readDoubleMatrix";
+((VFrameHeader*) op_writeHalfArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_writeHalfArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_writeHalfArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeHalfArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[56];
+((VFrameHeader*) op_writeHalfArray_thread_spec) -> functionName = "writeHalfArray";
+((VFrameHeader*) op_readHalfArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_readHalfArray_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readHalfArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_readHalfArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[57];
+((VFrameHeader*) op_readHalfArray_thread_spec) -> functionName = "readHalfArray";
+((VFrameHeader*) op_writeHalfMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_writeHalfMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_writeHalfMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeHalfMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[58];
+((VFrameHeader*) op_writeHalfMatrix_thread_spec) -> functionName = "writeHalfMatrix";
+((VFrameHeader*) op_readHalfMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 48;
+((VFrameHeader*) op_readHalfMatrix_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_readHalfMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_readHalfMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[59];
+((VFrameHeader*) op_readHalfMatrix_thread_spec) -> functionName = "readHalfMatrix";
+((VFrameHeader*) op_prepareKernel_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 64;
+((VFrameHeader*) op_prepareKernel_thread_spec) -> formalParamsCount = 5;
 ((VFrameHeader*) op_prepareKernel_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_prepareKernel_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[24];
+((VFrameHeader*) op_prepareKernel_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[60];
 ((VFrameHeader*) op_prepareKernel_thread_spec) -> functionName = "prepareKernel";
-((VFrameHeader*) op_runKernel_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
-((VFrameHeader*) op_runKernel_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_runKernel_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_runKernel_thread_spec) -> formalParamsCount = 4;
 ((VFrameHeader*) op_runKernel_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_runKernel_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[25];
+((VFrameHeader*) op_runKernel_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[61];
 ((VFrameHeader*) op_runKernel_thread_spec) -> functionName = "runKernel";
+((VFrameHeader*) op_runKernelAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 72;
+((VFrameHeader*) op_runKernelAsync_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_runKernelAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_runKernelAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[62];
+((VFrameHeader*) op_runKernelAsync_thread_spec) -> functionName = "runKernelAsync";
+((VFrameHeader*) op_writeIntArrayAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 64;
+((VFrameHeader*) op_writeIntArrayAsync_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_writeIntArrayAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeIntArrayAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[63];
+((VFrameHeader*) op_writeIntArrayAsync_thread_spec) -> functionName = "writeIntArrayAsync";
+((VFrameHeader*) op_writeFloatArrayAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeFloatArrayAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeFloatArrayAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeFloatArrayAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[64];
+((VFrameHeader*) op_writeFloatArrayAsync_thread_spec) -> functionName = "writeFloatArrayAsync";
+((VFrameHeader*) op_writeIntMatrixAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 64;
+((VFrameHeader*) op_writeIntMatrixAsync_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_writeIntMatrixAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeIntMatrixAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[65];
+((VFrameHeader*) op_writeIntMatrixAsync_thread_spec) -> functionName = "writeIntMatrixAsync";
+((VFrameHeader*) op_writeFloatMatrixAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeFloatMatrixAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeFloatMatrixAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeFloatMatrixAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[66];
+((VFrameHeader*) op_writeFloatMatrixAsync_thread_spec) -> functionName = "writeFloatMatrixAsync";
+((VFrameHeader*) op_writeDoubleArrayAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeDoubleArrayAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeDoubleArrayAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDoubleArrayAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[67];
+((VFrameHeader*) op_writeDoubleArrayAsync_thread_spec) -> functionName = "writeDoubleArrayAsync";
+((VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[68];
+((VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec) -> functionName = "writeDoubleMatrixAsync";
+((VFrameHeader*) op_writeHalfArrayAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeHalfArrayAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeHalfArrayAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeHalfArrayAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[69];
+((VFrameHeader*) op_writeHalfArrayAsync_thread_spec) -> functionName = "writeHalfArrayAsync";
+((VFrameHeader*) op_writeHalfMatrixAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 56;
+((VFrameHeader*) op_writeHalfMatrixAsync_thread_spec) -> formalParamsCount = 4;
+((VFrameHeader*) op_writeHalfMatrixAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeHalfMatrixAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[70];
+((VFrameHeader*) op_writeHalfMatrixAsync_thread_spec) -> functionName = "writeHalfMatrixAsync";
+((VFrameHeader*) op_writeIntRangeAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 80;
+((VFrameHeader*) op_writeIntRangeAsync_thread_spec) -> formalParamsCount = 7;
+((VFrameHeader*) op_writeIntRangeAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeIntRangeAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[71];
+((VFrameHeader*) op_writeIntRangeAsync_thread_spec) -> functionName = "writeIntRangeAsync";
+((VFrameHeader*) op_writeDecRangeAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 80;
+((VFrameHeader*) op_writeDecRangeAsync_thread_spec) -> formalParamsCount = 7;
+((VFrameHeader*) op_writeDecRangeAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDecRangeAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[72];
+((VFrameHeader*) op_writeDecRangeAsync_thread_spec) -> functionName = "writeDecRangeAsync";
+((VFrameHeader*) op_writeDecRowsAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 80;
+((VFrameHeader*) op_writeDecRowsAsync_thread_spec) -> formalParamsCount = 7;
+((VFrameHeader*) op_writeDecRowsAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_writeDecRowsAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[73];
+((VFrameHeader*) op_writeDecRowsAsync_thread_spec) -> functionName = "writeDecRowsAsync";
+((VFrameHeader*) op_readAsync_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 64;
+((VFrameHeader*) op_readAsync_thread_spec) -> formalParamsCount = 5;
+((VFrameHeader*) op_readAsync_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_readAsync_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[74];
+((VFrameHeader*) op_readAsync_thread_spec) -> functionName = "readAsync";
+((VFrameHeader*) op_collectIntArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectIntArray_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectIntArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectIntArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[75];
+((VFrameHeader*) op_collectIntArray_thread_spec) -> functionName = "collectIntArray";
+((VFrameHeader*) op_collectFloatArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectFloatArray_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectFloatArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectFloatArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[76];
+((VFrameHeader*) op_collectFloatArray_thread_spec) -> functionName = "collectFloatArray";
+((VFrameHeader*) op_collectIntMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectIntMatrix_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectIntMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectIntMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[77];
+((VFrameHeader*) op_collectIntMatrix_thread_spec) -> functionName = "collectIntMatrix";
+((VFrameHeader*) op_collectFloatMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectFloatMatrix_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectFloatMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectFloatMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[78];
+((VFrameHeader*) op_collectFloatMatrix_thread_spec) -> functionName = "collectFloatMatrix";
+((VFrameHeader*) op_collectDoubleArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectDoubleArray_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectDoubleArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectDoubleArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[79];
+((VFrameHeader*) op_collectDoubleArray_thread_spec) -> functionName = "collectDoubleArray";
+((VFrameHeader*) op_collectDoubleMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectDoubleMatrix_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectDoubleMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectDoubleMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[80];
+((VFrameHeader*) op_collectDoubleMatrix_thread_spec) -> functionName = "collectDoubleMatrix";
+((VFrameHeader*) op_collectHalfArray_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectHalfArray_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectHalfArray_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectHalfArray_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[81];
+((VFrameHeader*) op_collectHalfArray_thread_spec) -> functionName = "collectHalfArray";
+((VFrameHeader*) op_collectHalfMatrix_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 24;
+((VFrameHeader*) op_collectHalfMatrix_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_collectHalfMatrix_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectHalfMatrix_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[82];
+((VFrameHeader*) op_collectHalfMatrix_thread_spec) -> functionName = "collectHalfMatrix";
+((VFrameHeader*) op_collectIntInto_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_collectIntInto_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_collectIntInto_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectIntInto_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[83];
+((VFrameHeader*) op_collectIntInto_thread_spec) -> functionName = "collectIntInto";
+((VFrameHeader*) op_collectDecInto_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 40;
+((VFrameHeader*) op_collectDecInto_thread_spec) -> formalParamsCount = 3;
+((VFrameHeader*) op_collectDecInto_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_collectDecInto_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[84];
+((VFrameHeader*) op_collectDecInto_thread_spec) -> functionName = "collectDecInto";
+((VFrameHeader*) op_waitEvent_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_waitEvent_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_waitEvent_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_waitEvent_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[85];
+((VFrameHeader*) op_waitEvent_thread_spec) -> functionName = "waitEvent";
+((VFrameHeader*) op_getEventStatus_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getEventStatus_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_getEventStatus_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getEventStatus_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[86];
+((VFrameHeader*) op_getEventStatus_thread_spec) -> functionName = "getEventStatus";
+((VFrameHeader*) op_destroyEvent_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
+((VFrameHeader*) op_destroyEvent_thread_spec) -> formalParamsCount = 1;
+((VFrameHeader*) op_destroyEvent_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_destroyEvent_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[87];
+((VFrameHeader*) op_destroyEvent_thread_spec) -> functionName = "destroyEvent";
+((VFrameHeader*) op_getKernelCacheStats_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getKernelCacheStats_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getKernelCacheStats_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getKernelCacheStats_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[88];
+((VFrameHeader*) op_getKernelCacheStats_thread_spec) -> functionName = "getKernelCacheStats";
 ((VFrameHeader*) op_destroyContextSpace_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
 ((VFrameHeader*) op_destroyContextSpace_thread_spec) -> formalParamsCount = 1;
 ((VFrameHeader*) op_destroyContextSpace_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_destroyContextSpace_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[26];
+((VFrameHeader*) op_destroyContextSpace_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[89];
 ((VFrameHeader*) op_destroyContextSpace_thread_spec) -> functionName = "destroyContextSpace";
 ((VFrameHeader*) op_destroyQueue_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
 ((VFrameHeader*) op_destroyQueue_thread_spec) -> formalParamsCount = 1;
 ((VFrameHeader*) op_destroyQueue_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_destroyQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[27];
+((VFrameHeader*) op_destroyQueue_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[90];
 ((VFrameHeader*) op_destroyQueue_thread_spec) -> functionName = "destroyQueue";
 ((VFrameHeader*) op_destroyProgram_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 8;
 ((VFrameHeader*) op_destroyProgram_thread_spec) -> formalParamsCount = 1;
 ((VFrameHeader*) op_destroyProgram_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_destroyProgram_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[28];
+((VFrameHeader*) op_destroyProgram_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[91];
 ((VFrameHeader*) op_destroyProgram_thread_spec) -> functionName = "destroyProgram";
 ((VFrameHeader*) op_printLogs_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 0;
 ((VFrameHeader*) op_printLogs_thread_spec) -> formalParamsCount = 0;
 ((VFrameHeader*) op_printLogs_thread_spec) -> sub = NULL;
-((VFrameHeader*) op_printLogs_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[29];
+((VFrameHeader*) op_printLogs_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[92];
 ((VFrameHeader*) op_printLogs_thread_spec) -> functionName = "printLogs";
+((VFrameHeader*) op_getLogEntries_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getLogEntries_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getLogEntries_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getLogEntries_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[93];
+((VFrameHeader*) op_getLogEntries_thread_spec) -> functionName = "getLogEntries";
+((VFrameHeader*) op_getLogCalls_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getLogCalls_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getLogCalls_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getLogCalls_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[94];
+((VFrameHeader*) op_getLogCalls_thread_spec) -> functionName = "getLogCalls";
+((VFrameHeader*) op_getLogCounts_thread_spec) -> frameSize = sizeof(VFrame) + sizeof(VVarR) + 16;
+((VFrameHeader*) op_getLogCounts_thread_spec) -> formalParamsCount = 0;
+((VFrameHeader*) op_getLogCounts_thread_spec) -> sub = NULL;
+((VFrameHeader*) op_getLogCounts_thread_spec) -> localsDef = (size_t) &object_OpenCLLib_functions_spec[95];
+((VFrameHeader*) op_getLogCounts_thread_spec) -> functionName = "getLogCounts";
 memset(&self, '\0', sizeof(self));
 self.objects = objects; self.header = &header; self.header -> objectsCount = sizeof(objects) / sizeof(ObjectSpec);
 objectInterfaces[0].lbp.spec = &objects[0];
@@ -477,13 +1305,41 @@ static Fable interfaceMappings[] = {
 {"findPlatforms", (VFrameHeader*) op_findPlatforms_thread_spec},
 {"getComputeDeviceIDs", (VFrameHeader*) op_getComputeDeviceIDs_thread_spec},
 {"getComputeDevices", (VFrameHeader*) op_getComputeDevices_thread_spec},
+{"getHostDeviceName", (VFrameHeader*) op_getHostDeviceName_thread_spec},
+{"setVisibleDevices", (VFrameHeader*) op_setVisibleDevices_thread_spec},
+{"getVisibleDevices", (VFrameHeader*) op_getVisibleDevices_thread_spec},
 {"createContext", (VFrameHeader*) op_createContext_thread_spec},
 {"createAsynchQueue", (VFrameHeader*) op_createAsynchQueue_thread_spec},
 {"createSynchQueue", (VFrameHeader*) op_createSynchQueue_thread_spec},
 {"createArray", (VFrameHeader*) op_createArray_thread_spec},
 {"createMatrix", (VFrameHeader*) op_createMatrix_thread_spec},
+{"getMatrixRowPitch", (VFrameHeader*) op_getMatrixRowPitch_thread_spec},
+{"createRowView", (VFrameHeader*) op_createRowView_thread_spec},
+{"copyMatrixRegion", (VFrameHeader*) op_copyMatrixRegion_thread_spec},
+{"getDefaultAllocMode", (VFrameHeader*) op_getDefaultAllocMode_thread_spec},
+{"getDeviceLimits", (VFrameHeader*) op_getDeviceLimits_thread_spec},
+{"getTimestamp", (VFrameHeader*) op_getTimestamp_thread_spec},
+{"getTransferStats", (VFrameHeader*) op_getTransferStats_thread_spec},
+{"resetTransferStats", (VFrameHeader*) op_resetTransferStats_thread_spec},
+{"setBulkMarshalling", (VFrameHeader*) op_setBulkMarshalling_thread_spec},
 {"destroyMemoryArea", (VFrameHeader*) op_destroyMemoryArea_thread_spec},
+{"getPoolStats", (VFrameHeader*) op_getPoolStats_thread_spec},
+{"trimPool", (VFrameHeader*) op_trimPool_thread_spec},
+{"setPoolLimit", (VFrameHeader*) op_setPoolLimit_thread_spec},
 {"createProgram", (VFrameHeader*) op_createProgram_thread_spec},
+{"setBinaryCacheDir", (VFrameHeader*) op_setBinaryCacheDir_thread_spec},
+{"getBinaryCacheStats", (VFrameHeader*) op_getBinaryCacheStats_thread_spec},
+{"setTuningFile", (VFrameHeader*) op_setTuningFile_thread_spec},
+{"setAutotune", (VFrameHeader*) op_setAutotune_thread_spec},
+{"getAutotune", (VFrameHeader*) op_getAutotune_thread_spec},
+{"getTuningStats", (VFrameHeader*) op_getTuningStats_thread_spec},
+{"getTuning", (VFrameHeader*) op_getTuning_thread_spec},
+{"storeTuning", (VFrameHeader*) op_storeTuning_thread_spec},
+{"setProfiling", (VFrameHeader*) op_setProfiling_thread_spec},
+{"getProfiling", (VFrameHeader*) op_getProfiling_thread_spec},
+{"getProfileNames", (VFrameHeader*) op_getProfileNames_thread_spec},
+{"getProfile", (VFrameHeader*) op_getProfile_thread_spec},
+{"resetProfile", (VFrameHeader*) op_resetProfile_thread_spec},
 {"writeIntArray", (VFrameHeader*) op_writeIntArray_thread_spec},
 {"readIntArray", (VFrameHeader*) op_readIntArray_thread_spec},
 {"writeFloatArray", (VFrameHeader*) op_writeFloatArray_thread_spec},
@@ -492,12 +1348,50 @@ static Fable interfaceMappings[] = {
 {"readIntMatrix", (VFrameHeader*) op_readIntMatrix_thread_spec},
 {"writeFloatMatrix", (VFrameHeader*) op_writeFloatMatrix_thread_spec},
 {"readFloatMatrix", (VFrameHeader*) op_readFloatMatrix_thread_spec},
+{"writeDoubleArray", (VFrameHeader*) op_writeDoubleArray_thread_spec},
+{"readDoubleArray", (VFrameHeader*) op_readDoubleArray_thread_spec},
+{"writeDoubleMatrix", (VFrameHeader*) op_writeDoubleMatrix_thread_spec},
+{"readDoubleMatrix", (VFrameHeader*) op_readDoubleMatrix_thread_spec},
+{"writeHalfArray", (VFrameHeader*) op_writeHalfArray_thread_spec},
+{"readHalfArray", (VFrameHeader*) op_readHalfArray_thread_spec},
+{"writeHalfMatrix", (VFrameHeader*) op_writeHalfMatrix_thread_spec},
+{"readHalfMatrix", (VFrameHeader*) op_readHalfMatrix_thread_spec},
 {"prepareKernel", (VFrameHeader*) op_prepareKernel_thread_spec},
 {"runKernel", (VFrameHeader*) op_runKernel_thread_spec},
+{"runKernelAsync", (VFrameHeader*) op_runKernelAsync_thread_spec},
+{"writeIntArrayAsync", (VFrameHeader*) op_writeIntArrayAsync_thread_spec},
+{"writeFloatArrayAsync", (VFrameHeader*) op_writeFloatArrayAsync_thread_spec},
+{"writeIntMatrixAsync", (VFrameHeader*) op_writeIntMatrixAsync_thread_spec},
+{"writeFloatMatrixAsync", (VFrameHeader*) op_writeFloatMatrixAsync_thread_spec},
+{"writeDoubleArrayAsync", (VFrameHeader*) op_writeDoubleArrayAsync_thread_spec},
+{"writeDoubleMatrixAsync", (VFrameHeader*) op_writeDoubleMatrixAsync_thread_spec},
+{"writeHalfArrayAsync", (VFrameHeader*) op_writeHalfArrayAsync_thread_spec},
+{"writeHalfMatrixAsync", (VFrameHeader*) op_writeHalfMatrixAsync_thread_spec},
+{"writeIntRangeAsync", (VFrameHeader*) op_writeIntRangeAsync_thread_spec},
+{"writeDecRangeAsync", (VFrameHeader*) op_writeDecRangeAsync_thread_spec},
+{"writeDecRowsAsync", (VFrameHeader*) op_writeDecRowsAsync_thread_spec},
+{"readAsync", (VFrameHeader*) op_readAsync_thread_spec},
+{"collectIntArray", (VFrameHeader*) op_collectIntArray_thread_spec},
+{"collectFloatArray", (VFrameHeader*) op_collectFloatArray_thread_spec},
+{"collectIntMatrix", (VFrameHeader*) op_collectIntMatrix_thread_spec},
+{"collectFloatMatrix", (VFrameHeader*) op_collectFloatMatrix_thread_spec},
+{"collectDoubleArray", (VFrameHeader*) op_collectDoubleArray_thread_spec},
+{"collectDoubleMatrix", (VFrameHeader*) op_collectDoubleMatrix_thread_spec},
+{"collectHalfArray", (VFrameHeader*) op_collectHalfArray_thread_spec},
+{"collectHalfMatrix", (VFrameHeader*) op_collectHalfMatrix_thread_spec},
+{"collectIntInto", (VFrameHeader*) op_collectIntInto_thread_spec},
+{"collectDecInto", (VFrameHeader*) op_collectDecInto_thread_spec},
+{"waitEvent", (VFrameHeader*) op_waitEvent_thread_spec},
+{"getEventStatus", (VFrameHeader*) op_getEventStatus_thread_spec},
+{"destroyEvent", (VFrameHeader*) op_destroyEvent_thread_spec},
+{"getKernelCacheStats", (VFrameHeader*) op_getKernelCacheStats_thread_spec},
 {"destroyContextSpace", (VFrameHeader*) op_destroyContextSpace_thread_spec},
 {"destroyQueue", (VFrameHeader*) op_destroyQueue_thread_spec},
 {"destroyProgram", (VFrameHeader*) op_destroyProgram_thread_spec},
-{"printLogs", (VFrameHeader*) op_printLogs_thread_spec}};
+{"printLogs", (VFrameHeader*) op_printLogs_thread_spec},
+{"getLogEntries", (VFrameHeader*) op_getLogEntries_thread_spec},
+{"getLogCalls", (VFrameHeader*) op_getLogCalls_thread_spec},
+{"getLogCounts", (VFrameHeader*) op_getLogCounts_thread_spec}};
 void setInterfaceFunction(char *name, void *ptr){
 int i = 0;
 for (i = 0; i < sizeof(interfaceMappings) / sizeof(Fable); i ++){
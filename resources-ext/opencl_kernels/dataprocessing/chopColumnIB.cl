@@ -0,0 +1,14 @@
+//chopColumnI.cl for buffer matrices, startEnd = {start, end, pitch of in, pitch of out}
+//cells are uint32, or the element type given with e.g. -D INT_T=short
+#ifndef INT_T
+#define INT_T uint
+#endif
+
+__kernel void chopColumnIB(__global long unsigned int* startEnd, __global const INT_T* in, __global INT_T* out) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+
+    //columns from start on are taken from past the end of the cut
+    size_t from = col < startEnd[0] ? col : col + (startEnd[1] - startEnd[0]);
+    out[row * startEnd[3] + col] = in[row * startEnd[2] + from];
+}
@@ -0,0 +1,19 @@
+//chopRowF.cl for buffer matrices, startEnd = {start, end, pitch of in, pitch of out}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void chopRowFB(__global long unsigned int* startEnd, __global const REAL* in, __global REAL* out) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+
+    //rows from start on are taken from past the end of the cut
+    size_t from = row < startEnd[0] ? row : row + (startEnd[1] - startEnd[0]);
+    out[row * startEnd[3] + col] = in[from * startEnd[2] + col];
+}
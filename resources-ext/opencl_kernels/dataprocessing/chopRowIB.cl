@@ -0,0 +1,14 @@
+//chopRowI.cl for buffer matrices, startEnd = {start, end, pitch of in, pitch of out}
+//cells are uint32, or the element type given with e.g. -D INT_T=short
+#ifndef INT_T
+#define INT_T uint
+#endif
+
+__kernel void chopRowIB(__global long unsigned int* startEnd, __global const INT_T* in, __global INT_T* out) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+
+    //rows from start on are taken from past the end of the cut
+    size_t from = row < startEnd[0] ? row : row + (startEnd[1] - startEnd[0]);
+    out[row * startEnd[3] + col] = in[from * startEnd[2] + col];
+}
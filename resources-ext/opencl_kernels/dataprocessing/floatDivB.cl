@@ -0,0 +1,17 @@
+//floatDiv.cl for buffer matrices, dims = {pitch of matrix, pitch of matrix_write}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void floatDivB(__global const long unsigned int* dims, __global REAL* divider, __global const REAL* matrix, __global REAL* matrix_write) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+
+    matrix_write[row * dims[1] + col] = matrix[row * dims[0] + col] / divider[0];
+}
@@ -0,0 +1,20 @@
+//intToDouble.cl for buffer matrices, dims = {pitch of inputMatrix, pitch of outputMatrix}
+#ifndef REAL
+#define REAL float
+#endif
+#ifndef INT_T
+#define INT_T int
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void intToDoubleB(__global const long unsigned int* dims, __global const INT_T* inputMatrix, __global REAL* outputMatrix) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+
+    outputMatrix[row * dims[1] + col] = (REAL) inputMatrix[row * dims[0] + col];
+}
@@ -0,0 +1,126 @@
+//Batched small matrix operations in one launch: gemm_batched, dims = {M, N, K,
+//lda, ldb, ldc}, gemv_batched, dims = {R, C, ldt, ldv, ldo}, and
+//transpose_batched, dims = {R, C, ldm, ldt}. The entries of a batch are
+//stacked down the rows of buffer matrices, entry g of a stack of R-row
+//entries starting at row g * R (and of a stack of vectors at row g).
+//Work-group g computes entry g, its work-items striding over the cells of the
+//entry's result. Built with -D STAGE=n, an entry's operands are first copied
+//into n cells of local memory when they fit, so each is read from global
+//memory once and in order
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+//C = A * B for each entry
+__kernel void gemm_batched( __global const long unsigned int* dims, __global const REAL* A, __global const REAL* B, __global REAL* C ) {
+    const size_t M = dims[0];
+    const size_t N = dims[1];
+    const size_t K = dims[2];
+    const size_t g = get_group_id(0);
+    const size_t lid = get_local_id(0);
+    const size_t ls = get_local_size(0);
+    __global const REAL* a = A + g * M * dims[3];
+    __global const REAL* b = B + g * K * dims[4];
+    __global REAL* c = C + g * M * dims[5];
+#ifdef STAGE
+    __local REAL stage[STAGE];
+    if (M * K + K * N <= STAGE) {
+        for (size_t i = lid; i < M * K; i += ls) {
+            stage[i] = a[(i / K) * dims[3] + i % K];
+        }
+        for (size_t i = lid; i < K * N; i += ls) {
+            stage[M * K + i] = b[(i / N) * dims[4] + i % N];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (size_t i = lid; i < M * N; i += ls) {
+            const size_t row = i / N;
+            const size_t col = i % N;
+            REAL sum = 0.0;
+            for (size_t k = 0; k < K; k++) {
+                sum += stage[row * K + k] * stage[M * K + k * N + col];
+            }
+            c[row * dims[5] + col] = sum;
+        }
+        return;
+    }
+#endif
+    for (size_t i = lid; i < M * N; i += ls) {
+        const size_t row = i / N;
+        const size_t col = i % N;
+        REAL sum = 0.0;
+        for (size_t k = 0; k < K; k++) {
+            sum += a[row * dims[3] + k] * b[k * dims[4] + col];
+        }
+        c[row * dims[5] + col] = sum;
+    }
+}
+
+//row g of out = T * row g of V for each entry, T R x C
+__kernel void gemv_batched( __global const long unsigned int* dims, __global const REAL* T, __global const REAL* V, __global REAL* out ) {
+    const size_t R = dims[0];
+    const size_t C = dims[1];
+    const size_t g = get_group_id(0);
+    const size_t lid = get_local_id(0);
+    const size_t ls = get_local_size(0);
+    __global const REAL* t = T + g * R * dims[2];
+    __global const REAL* v = V + g * dims[3];
+    __global REAL* o = out + g * dims[4];
+#ifdef STAGE
+    __local REAL stage[STAGE];
+    if (C <= STAGE) {
+        for (size_t k = lid; k < C; k += ls) {
+            stage[k] = v[k];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (size_t r = lid; r < R; r += ls) {
+            REAL sum = 0.0;
+            for (size_t k = 0; k < C; k++) {
+                sum += t[r * dims[2] + k] * stage[k];
+            }
+            o[r] = sum;
+        }
+        return;
+    }
+#endif
+    for (size_t r = lid; r < R; r += ls) {
+        REAL sum = 0.0;
+        for (size_t k = 0; k < C; k++) {
+            sum += t[r * dims[2] + k] * v[k];
+        }
+        o[r] = sum;
+    }
+}
+
+//Mt = the transpose of M for each entry, M R x C. Staged, both the reads
+//and the writes go along rows
+__kernel void transpose_batched( __global const long unsigned int* dims, __global const REAL* M, __global REAL* Mt ) {
+    const size_t R = dims[0];
+    const size_t C = dims[1];
+    const size_t g = get_group_id(0);
+    const size_t lid = get_local_id(0);
+    const size_t ls = get_local_size(0);
+    __global const REAL* m = M + g * R * dims[2];
+    __global REAL* t = Mt + g * C * dims[3];
+#ifdef STAGE
+    __local REAL stage[STAGE];
+    if (R * C <= STAGE) {
+        for (size_t i = lid; i < R * C; i += ls) {
+            stage[i] = m[(i / C) * dims[2] + i % C];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (size_t i = lid; i < R * C; i += ls) {
+            t[(i / R) * dims[3] + i % R] = stage[(i % R) * C + i / R];
+        }
+        return;
+    }
+#endif
+    for (size_t i = lid; i < R * C; i += ls) {
+        t[(i / R) * dims[3] + i % R] = m[(i % R) * dims[2] + i / R];
+    }
+}
@@ -0,0 +1,68 @@
+//As gemmtiled.cl, but register blocked: each work-item computes WPT cells of
+//a column of the TS x TS tile (rows ty, ty + RTS, ..., where RTS = TS / WPT),
+//keeping them in registers, so each value of B read from local memory is
+//reused WPT times.
+//Launch with global size {N rounded up to TS, M rounded up to TS / WPT} and
+//local size {TS, TS / WPT}. TS must be a multiple of WPT
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+#ifndef TS
+#define TS 32
+#endif
+#ifndef WPT
+#define WPT 8
+#endif
+#define RTS (TS / WPT)
+
+__kernel void gemm_blocked( __global const long unsigned int* dims, __global const REAL* A, __global const REAL* B, __global REAL* C ) {
+    const int M = dims[0];
+    const int N = dims[1];
+    const int K = dims[2];
+    const size_t lda = dims[3];
+    const size_t ldb = dims[4];
+    const size_t ldc = dims[5];
+
+    const int tx = get_local_id(0);
+    const int ty = get_local_id(1);
+    const int col = get_group_id(0) * TS + tx;
+    const int rowBase = get_group_id(1) * TS;
+
+    __local REAL Asub[TS][TS];
+    __local REAL Bsub[TS][TS];
+
+    REAL acc[WPT];
+    for (int w = 0; w < WPT; w++) {
+        acc[w] = 0.0f;
+    }
+
+    for (int t = 0; t < K; t += TS) {
+        for (int w = 0; w < WPT; w++) {
+            const int r = ty + w * RTS;
+            Asub[r][tx] = (rowBase + r < M && t + tx < K) ? A[(rowBase + r) * lda + t + tx] : 0.0f;
+            Bsub[r][tx] = (t + r < K && col < N) ? B[(t + r) * ldb + col] : 0.0f;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int k = 0; k < TS; k++) {
+            const REAL b = Bsub[k][tx];
+            for (int w = 0; w < WPT; w++) {
+                acc[w] += Asub[ty + w * RTS][k] * b;
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    for (int w = 0; w < WPT; w++) {
+        const int row = rowBase + ty + w * RTS;
+        if (row < M && col < N) {
+            C[row * ldc + col] = acc[w];
+        }
+    }
+}
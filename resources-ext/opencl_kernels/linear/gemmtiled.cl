@@ -0,0 +1,53 @@
+//C = A * B for row-major buffer matrices, dims = {M, N, K, lda, ldb, ldc} where
+//A is M x K, B is K x N, C is M x N and lda, ldb, ldc are their row pitches in
+//elements. Each work-group computes a TS x TS tile of C, stepping through K a
+//tile at a time with the matching tiles of A and B staged in local memory, so
+//each value is read from global memory once per work-group rather than once
+//per work-item.
+//Launch with global size {N, M} rounded up to multiples of TS and local size {TS, TS}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+#ifndef TS
+#define TS 16
+#endif
+
+__kernel void gemm_tiled( __global const long unsigned int* dims, __global const REAL* A, __global const REAL* B, __global REAL* C ) {
+    const int M = dims[0];
+    const int N = dims[1];
+    const int K = dims[2];
+    const size_t lda = dims[3];
+    const size_t ldb = dims[4];
+    const size_t ldc = dims[5];
+
+    const int tx = get_local_id(0);
+    const int ty = get_local_id(1);
+    const int col = get_group_id(0) * TS + tx;
+    const int row = get_group_id(1) * TS + ty;
+
+    __local REAL Asub[TS][TS];
+    __local REAL Bsub[TS][TS];
+
+    REAL acc = 0.0f;
+    for (int t = 0; t < K; t += TS) {
+        //cells past the edge of A or B load as 0 so partial tiles add nothing
+        Asub[ty][tx] = (row < M && t + tx < K) ? A[row * lda + t + tx] : 0.0f;
+        Bsub[ty][tx] = (t + ty < K && col < N) ? B[(t + ty) * ldb + col] : 0.0f;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int k = 0; k < TS; k++) {
+            acc += Asub[ty][k] * Bsub[k][tx];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (row < M && col < N) {
+        C[row * ldc + col] = acc;
+    }
+}
@@ -0,0 +1,20 @@
+//lintransd.cl for a buffer matrix T, dims = {cols of T, pitch of T}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void lintransdb( __global const long unsigned int* dims, __global const REAL* T, __global const REAL* V, __global REAL* Vt ) {
+    size_t i = get_global_id(0);
+    __global const REAL* row = T + i * dims[1];
+    REAL sum = 0.0;
+    for (size_t k = 0; k < dims[0]; k++) {
+        sum += V[k] * row[k];
+    }
+    Vt[i] = sum;
+}
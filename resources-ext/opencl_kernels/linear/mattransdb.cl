@@ -0,0 +1,17 @@
+//mattransd.cl for buffer matrices, dims = {pitch of M, pitch of Mt}.
+//One work-item per cell of Mt, global size {rows of Mt, cols of Mt}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void mattransdb( __global const long unsigned int* dims, __global const REAL* M, __global REAL* Mt ) {
+    size_t row = get_global_id(0);
+    size_t col = get_global_id(1);
+    Mt[row * dims[1] + col] = M[col * dims[0] + row];
+}
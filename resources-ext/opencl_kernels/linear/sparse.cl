@@ -0,0 +1,120 @@
+//Sparse matrix times dense vector (spmv_*, dims = {count, nnz, coo}) and
+//times dense buffer matrix (spmm_*, dims = {count, nnz, coo, N, ldb, ldc}),
+//params (dims, list, rows, cols, values, in, out). The sparse matrix is CSR,
+//'rows' holding the offset of each row's first value and one past the last,
+//or with coo != 0 COO, 'rows' holding the row of each value in row order.
+//Only the 'count' rows in 'list' are computed: the _scalar kernels take a row
+//per work-item, for rows of few values, and the _vector kernels a row per
+//work-group of VS work-items, which share its values and sum them in local
+//memory, for long rows. Indices are 32 bit
+#ifndef REAL
+#define REAL float
+#endif
+#ifndef VS
+#define VS 32
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+//first index of 'rows' holding a row at or after r
+uint lowerBound(__global const uint* rows, uint n, ulong r) {
+    uint lo = 0;
+    uint hi = n;
+    while (lo < hi) {
+        uint mid = lo + (hi - lo) / 2;
+        if (rows[mid] < r) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+//the first of row r's values and one past its last
+uint2 rowRange(__global const uint* rows, ulong r, __global const long unsigned int* dims) {
+    if (dims[2] == 0) {
+        return (uint2)(rows[r], rows[r + 1]);
+    }
+    return (uint2)(lowerBound(rows, (uint) dims[1], r), lowerBound(rows, (uint) dims[1], r + 1));
+}
+
+//sums the lanes' partials in local memory, the total ends up in partial[0]
+void sumLanes(__local REAL* partial, size_t lane) {
+    for (size_t s = VS / 2; s > 0; s >>= 1) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lane < s) {
+            partial[lane] += partial[lane + s];
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+}
+
+__kernel void spmv_scalar( __global const long unsigned int* dims, __global const uint* list, __global const uint* rows, __global const uint* cols, __global const REAL* values, __global const REAL* x, __global REAL* y ) {
+    size_t i = get_global_id(0);
+    if (i >= dims[0]) {
+        return;
+    }
+    uint r = list[i];
+    uint2 range = rowRange(rows, r, dims);
+    REAL sum = 0.0;
+    for (uint p = range.x; p < range.y; p++) {
+        sum += values[p] * x[cols[p]];
+    }
+    y[r] = sum;
+}
+
+__kernel void spmv_vector( __global const long unsigned int* dims, __global const uint* list, __global const uint* rows, __global const uint* cols, __global const REAL* values, __global const REAL* x, __global REAL* y ) {
+    __local REAL partial[VS];
+    size_t lane = get_local_id(0);
+    uint r = list[get_group_id(0)];
+    uint2 range = rowRange(rows, r, dims);
+    REAL sum = 0.0;
+    for (uint p = range.x + lane; p < range.y; p += VS) {
+        sum += values[p] * x[cols[p]];
+    }
+    partial[lane] = sum;
+    sumLanes(partial, lane);
+    if (lane == 0) {
+        y[r] = partial[0];
+    }
+}
+
+//work-item (i, j) computes column j of row list[i]
+__kernel void spmm_scalar( __global const long unsigned int* dims, __global const uint* list, __global const uint* rows, __global const uint* cols, __global const REAL* values, __global const REAL* B, __global REAL* C ) {
+    size_t i = get_global_id(0);
+    size_t j = get_global_id(1);
+    if (i >= dims[0] || j >= dims[3]) {
+        return;
+    }
+    uint r = list[i];
+    uint2 range = rowRange(rows, r, dims);
+    REAL sum = 0.0;
+    for (uint p = range.x; p < range.y; p++) {
+        sum += values[p] * B[cols[p] * dims[4] + j];
+    }
+    C[r * dims[5] + j] = sum;
+}
+
+//each column of the row is summed by the whole work-group in turn
+__kernel void spmm_vector( __global const long unsigned int* dims, __global const uint* list, __global const uint* rows, __global const uint* cols, __global const REAL* values, __global const REAL* B, __global REAL* C ) {
+    __local REAL partial[VS];
+    size_t lane = get_local_id(0);
+    uint r = list[get_group_id(0)];
+    uint2 range = rowRange(rows, r, dims);
+    for (size_t j = 0; j < dims[3]; j++) {
+        REAL sum = 0.0;
+        for (uint p = range.x + lane; p < range.y; p += VS) {
+            sum += values[p] * B[cols[p] * dims[4] + j];
+        }
+        partial[lane] = sum;
+        sumLanes(partial, lane);
+        if (lane == 0) {
+            C[r * dims[5] + j] = partial[0];
+        }
+    }
+}
@@ -1,4 +1,14 @@
-__kernel void vaddd( __global const float *A, __global const float *B, __global float *restrict C ) {
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void vaddd( __global const REAL *A, __global const REAL *B, __global REAL *restrict C ) {
     int i = get_global_id(0);
     C[i] = A[i] + B[i];
 }
@@ -1,4 +1,9 @@
-__kernel void vaddi( __global const long unsigned int *A, __global const long unsigned int *B, __global long unsigned int *restrict C ) {
+//cells are 64 bit, or the element type given with e.g. -D INT_T=short
+#ifndef INT_T
+#define INT_T ulong
+#endif
+
+__kernel void vaddi( __global const INT_T *A, __global const INT_T *B, __global INT_T *restrict C ) {
     int i = get_global_id(0);
     C[i] = A[i] + B[i];
 }
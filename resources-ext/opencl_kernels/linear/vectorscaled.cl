@@ -1,4 +1,14 @@
-__kernel void vscaled( __global const float* scalar, __global float* A ) {
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+__kernel void vscaled( __global const REAL* scalar, __global REAL* A ) {
     int i = get_global_id(0);
     A[i] = scalar[0] * A[i];
 }
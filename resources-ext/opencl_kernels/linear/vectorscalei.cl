@@ -1,4 +1,9 @@
-__kernel void vscalei( __global const long unsigned int* scalar, __global long unsigned int *A ) {
+//cells are 64 bit, or the element type given with e.g. -D INT_T=short
+#ifndef INT_T
+#define INT_T ulong
+#endif
+
+__kernel void vscalei( __global const long unsigned int* scalar, __global INT_T *A ) {
     int i = get_global_id(0);
-    A[i] = scalar[0] * A[i];
+    A[i] = (INT_T) (scalar[0] * A[i]);
 }
@@ -0,0 +1,119 @@
+//Counter-based generator, Philox4x32-10 (Salmon et al. 2011), with the kernels
+//philoxu (uniform in [lo, hi)), philoxn (normal, lohi = {mean, stddev}) and
+//philoxi (ints in [lo, hi]). params = {seed, stream, first, cells, cols, pitch}:
+//cell first + j of the stream is stored at (j / cols) * pitch + j % cols.
+//Cell c is word c % 4 of the block for counter c / 4, keyed by the seed, so a
+//cell's value doesn't depend on the launch, the layout or the chunk it's made in.
+//Work-item i makes the 4 cells of block first / 4 + i that are in range
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+//a half precision output is built with -D HALF_OUT, which stores through
+//vstore_half so the arithmetic stays in REAL, and an int output of another
+//element type than long with, e.g., -D INT_T=char
+#ifdef HALF_OUT
+#define OUT_T half
+#define STORE(p, i, v) vstore_half(v, i, p)
+#else
+#define OUT_T REAL
+#define STORE(p, i, v) (p)[i] = (v)
+#endif
+#ifndef INT_T
+#define INT_T long
+#endif
+
+#define PHILOX_M0 0xD2511F53
+#define PHILOX_M1 0xCD9E8D57
+#define PHILOX_W0 0x9E3779B9
+#define PHILOX_W1 0xBB67AE85
+
+uint4 philox(ulong block, ulong stream, ulong seed) {
+    uint4 ctr = (uint4)((uint) block, (uint) (block >> 32), (uint) stream, (uint) (stream >> 32));
+    uint2 key = (uint2)((uint) seed, (uint) (seed >> 32));
+    for (int r = 0; r < 10; r++) {
+        uint hi0 = mul_hi((uint) PHILOX_M0, ctr.x);
+        uint lo0 = PHILOX_M0 * ctr.x;
+        uint hi1 = mul_hi((uint) PHILOX_M1, ctr.z);
+        uint lo1 = PHILOX_M1 * ctr.z;
+        ctr = (uint4)(hi1 ^ ctr.y ^ key.x, lo1, hi0 ^ ctr.w ^ key.y, lo0);
+        key += (uint2)(PHILOX_W0, PHILOX_W1);
+    }
+    return ctr;
+}
+
+//(0, 1) from the top 24 bits of a word, so it's exact in float
+REAL unitInterval(uint w) {
+    return ((REAL) (w >> 8) + (REAL) 0.5) * (REAL) (1.0 / 16777216.0);
+}
+
+//words of the work-item's block, and where each of its cells goes (-1 if out of range)
+uint4 philoxBlock(__global const ulong* params, long4* at) {
+    ulong first = params[2];
+    ulong cells = params[3];
+    ulong cols = params[4];
+    ulong pitch = params[5];
+    ulong b = first / 4 + get_global_id(0);
+    long w[4];
+    for (int k = 0; k < 4; k++) {
+        ulong c = b * 4 + k;
+        w[k] = -1;
+        if (c >= first && c < first + cells) {
+            ulong j = c - first;
+            w[k] = (long) ((j / cols) * pitch + j % cols);
+        }
+    }
+    *at = (long4)(w[0], w[1], w[2], w[3]);
+    return philox(b, params[1], params[0]);
+}
+
+__kernel void philoxu(__global const ulong* params, __global const REAL* lohi, __global OUT_T* out) {
+    long4 at;
+    uint4 w = philoxBlock(params, &at);
+    REAL lo = lohi[0];
+    REAL diff = lohi[1] - lohi[0];
+    if (at.x >= 0) STORE(out, at.x, lo + diff * unitInterval(w.x));
+    if (at.y >= 0) STORE(out, at.y, lo + diff * unitInterval(w.y));
+    if (at.z >= 0) STORE(out, at.z, lo + diff * unitInterval(w.z));
+    if (at.w >= 0) STORE(out, at.w, lo + diff * unitInterval(w.w));
+}
+
+//Box-Muller on the pairs (x, y) and (z, w) of the block
+__kernel void philoxn(__global const ulong* params, __global const REAL* lohi, __global OUT_T* out) {
+    long4 at;
+    uint4 w = philoxBlock(params, &at);
+    REAL mean = lohi[0];
+    REAL stddev = lohi[1];
+    REAL r0 = sqrt((REAL) -2.0 * log(unitInterval(w.x)));
+    REAL t0 = (REAL) 6.283185307179586 * unitInterval(w.y);
+    REAL r1 = sqrt((REAL) -2.0 * log(unitInterval(w.z)));
+    REAL t1 = (REAL) 6.283185307179586 * unitInterval(w.w);
+    if (at.x >= 0) STORE(out, at.x, mean + stddev * r0 * cos(t0));
+    if (at.y >= 0) STORE(out, at.y, mean + stddev * r0 * sin(t0));
+    if (at.z >= 0) STORE(out, at.z, mean + stddev * r1 * cos(t1));
+    if (at.w >= 0) STORE(out, at.w, mean + stddev * r1 * sin(t1));
+}
+
+//lo + floor(w * range / 2^32) rather than w % range, so any unevenness is
+//spread across the range instead of piled at its start; a range of more
+//than 2^32 ints is covered in 2^32 even steps
+long inRange(uint w, long lo, ulong range) {
+    return lo + (long) ((ulong) w * (range >> 32) + (((ulong) w * (uint) range) >> 32));
+}
+
+__kernel void philoxi(__global const ulong* params, __global const long* lohi, __global INT_T* out) {
+    long4 at;
+    uint4 w = philoxBlock(params, &at);
+    long lo = lohi[0];
+    ulong range = (ulong) (lohi[1] - lohi[0]) + 1;
+    if (at.x >= 0) out[at.x] = (INT_T) inRange(w.x, lo, range);
+    if (at.y >= 0) out[at.y] = (INT_T) inRange(w.y, lo, range);
+    if (at.z >= 0) out[at.z] = (INT_T) inRange(w.z, lo, range);
+    if (at.w >= 0) out[at.w] = (INT_T) inRange(w.w, lo, range);
+}
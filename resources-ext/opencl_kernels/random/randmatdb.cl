@@ -0,0 +1,48 @@
+//randmatd.cl for a buffer matrix, dims = {pitch of matrix}
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
+uint getInt(uint top, uint seed) {
+    if (top == 0) {return 0;}
+    uint hi;
+    uint lo;
+
+    lo = 16807 * (seed * 0xFFFF);
+    hi = 16807 * (seed >> 16);
+
+    lo += (hi & 0x7FFF) << 16;
+    lo += hi >> 15;
+
+    if (lo > 0x7FFFFFFF) {
+        lo -= 0x7FFFFFFF;
+    }
+
+    seed = lo;
+    
+    return seed % top;
+}
+
+__kernel void randmatdb(__global long unsigned int* seed_in, __global REAL* lohi, __global const long unsigned int* dims, __global REAL* matrix) {
+    int row = get_global_id(0);
+    int col = get_global_id(1);
+
+    uint seed = (seed_in[0] + (row*row) + col)*(seed_in[0] + row + col);
+
+    REAL diff = lohi[1] - lohi[0];
+    uint discreteStepsMax = getInt(10001, seed);
+    uint discreteStepsTaken = getInt(discreteStepsMax+1, seed);
+
+    REAL increments = diff / discreteStepsMax;
+    REAL add = increments * discreteStepsTaken;
+
+    REAL rnd = lohi[0] + add;
+
+    matrix[(size_t) row * dims[0] + col] = rnd;
+}
@@ -1,3 +1,13 @@
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+
 uint getInt(uint top, uint seed) {
     if (top == 0) {return 0;}
     uint hi;
@@ -18,19 +28,19 @@ uint getInt(uint top, uint seed) {
     return seed % top;
 }
 
-__kernel void randvecd(__global long unsigned int* seed_in, __global float* lohi, __global float* v) {
+__kernel void randvecd(__global long unsigned int* seed_in, __global REAL* lohi, __global REAL* v) {
     int row = get_global_id(0);
 
     uint seed = (seed_in[0] + (row*row))*(seed_in[0] + row);
 
-    float diff = lohi[1] - lohi[0];
+    REAL diff = lohi[1] - lohi[0];
     uint discreteStepsMax = getInt(10001, seed);
     uint discreteStepsTaken = getInt(discreteStepsMax+1, seed);
 
-    float increments = diff / discreteStepsMax;
-    float add = increments * discreteStepsTaken;
+    REAL increments = diff / discreteStepsMax;
+    REAL add = increments * discreteStepsTaken;
 
-    float rnd = lohi[0] + add;
+    REAL rnd = lohi[0] + add;
 
     v[row] = rnd;
 }
@@ -0,0 +1,81 @@
+//Tree reduction finding the index of the smallest (op 2) or largest (op 3)
+//value of a REAL buffer (see reduced.cl), params = {n, op, indexed, cols, pitch} with cols
+//and pitch as in reduced.cl. Indices count cells in row order, not padding.
+//Ties go to the lower index. As reduced.cl, the first pass runs over the
+//input (indexed = 0, inIdx is ignored) writing a value and index per group to
+//outVal/outIdx, and the second pass runs over those partials (indexed = 1)
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+#ifndef RS
+#define RS 256
+#endif
+
+//the first pass over a half precision buffer is built with -D HALF_IN, which
+//reads the input through vload_half so the arithmetic stays in REAL
+#ifdef HALF_IN
+#define IN_T half
+#define LOAD(p, i) vload_half(i, p)
+#else
+#define IN_T REAL
+#define LOAD(p, i) (p)[i]
+#endif
+
+//true if (vb, ib) should replace (va, ia)
+bool betterd(REAL va, ulong ia, REAL vb, ulong ib, ulong op) {
+    if (vb == va) {
+        return ib < ia;
+    }
+    return op == 2 ? vb < va : vb > va;
+}
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void argreduced( __global const long unsigned int* params, __global const IN_T* in, __global const long unsigned int* inIdx, __global REAL* outVal, __global long unsigned int* outIdx ) {
+    const ulong n = params[0];
+    const ulong op = params[1];
+    const ulong indexed = params[2];
+    const ulong cols = params[3];
+    const ulong pitch = params[4];
+    const int lid = get_local_id(0);
+    __local REAL scratchVal[RS];
+    __local ulong scratchIdx[RS];
+
+    REAL val = op == 2 ? INFINITY : -INFINITY;
+    ulong idx = ULONG_MAX;
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        ulong at = indexed ? inIdx[i] : i;
+        const ulong cell = cellOffset(i, cols, pitch);
+        const REAL v = LOAD(in, cell);
+        if (betterd(val, idx, v, at, op)) {
+            val = v;
+            idx = at;
+        }
+    }
+    scratchVal[lid] = val;
+    scratchIdx[lid] = idx;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s && betterd(scratchVal[lid], scratchIdx[lid], scratchVal[lid + s], scratchIdx[lid + s], op)) {
+            scratchVal[lid] = scratchVal[lid + s];
+            scratchIdx[lid] = scratchIdx[lid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        outVal[get_group_id(0)] = scratchVal[0];
+        outIdx[get_group_id(0)] = scratchIdx[0];
+    }
+}
@@ -0,0 +1,63 @@
+//As argreduced.cl for int buffers, whose cells are signed 64 bit unless built with INT_T
+#ifndef RS
+#define RS 256
+#endif
+
+//the first pass over a buffer of another element type is built with, e.g.,
+//-D INT_T=char; the arithmetic stays in long
+#ifndef INT_T
+#define INT_T long
+#endif
+
+//true if (vb, ib) should replace (va, ia)
+bool betteri(long va, ulong ia, long vb, ulong ib, ulong op) {
+    if (vb == va) {
+        return ib < ia;
+    }
+    return op == 2 ? vb < va : vb > va;
+}
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void argreducei( __global const long unsigned int* params, __global const INT_T* in, __global const long unsigned int* inIdx, __global long* outVal, __global long unsigned int* outIdx ) {
+    const ulong n = params[0];
+    const ulong op = params[1];
+    const ulong indexed = params[2];
+    const ulong cols = params[3];
+    const ulong pitch = params[4];
+    const int lid = get_local_id(0);
+    __local long scratchVal[RS];
+    __local ulong scratchIdx[RS];
+
+    long val = op == 2 ? LONG_MAX : LONG_MIN;
+    ulong idx = ULONG_MAX;
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        ulong at = indexed ? inIdx[i] : i;
+        const ulong cell = cellOffset(i, cols, pitch);
+        const long v = in[cell];
+        if (betteri(val, idx, v, at, op)) {
+            val = v;
+            idx = at;
+        }
+    }
+    scratchVal[lid] = val;
+    scratchIdx[lid] = idx;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s && betteri(scratchVal[lid], scratchIdx[lid], scratchVal[lid + s], scratchIdx[lid + s], op)) {
+            scratchVal[lid] = scratchVal[lid + s];
+            scratchIdx[lid] = scratchIdx[lid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        outVal[get_group_id(0)] = scratchVal[0];
+        outIdx[get_group_id(0)] = scratchIdx[0];
+    }
+}
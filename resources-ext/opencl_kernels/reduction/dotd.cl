@@ -0,0 +1,58 @@
+//First pass of a REAL dot product (see reduced.cl), params = {n, op, cols, pitch} with op
+//ignored: as reduced.cl with the sum op, but folding A[i] * B[i] so the
+//products are never stored. The partials in 'out' are then summed with reduced
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+#ifndef RS
+#define RS 256
+#endif
+
+//the first pass over a half precision buffer is built with -D HALF_IN, which
+//reads the input through vload_half so the arithmetic stays in REAL
+#ifdef HALF_IN
+#define IN_T half
+#define LOAD(p, i) vload_half(i, p)
+#else
+#define IN_T REAL
+#define LOAD(p, i) (p)[i]
+#endif
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void dotd( __global const long unsigned int* params, __global const IN_T* A, __global const IN_T* B, __global REAL* out ) {
+    const ulong n = params[0];
+    const ulong cols = params[2];
+    const ulong pitch = params[3];
+    const int lid = get_local_id(0);
+    __local REAL scratch[RS];
+
+    REAL acc = 0.0f;
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        const ulong cell = cellOffset(i, cols, pitch);
+        acc += LOAD(A, cell) * LOAD(B, cell);
+    }
+    scratch[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s) {
+            scratch[lid] += scratch[lid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        out[get_group_id(0)] = scratch[0];
+    }
+}
@@ -0,0 +1,43 @@
+//As dotd.cl for int buffers, the partials are summed with reducei
+#ifndef RS
+#define RS 256
+#endif
+
+//a buffer of another element type is built with, e.g.,
+//-D INT_T=char; the arithmetic stays in long
+#ifndef INT_T
+#define INT_T long
+#endif
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void doti( __global const long unsigned int* params, __global const INT_T* A, __global const INT_T* B, __global long* out ) {
+    const ulong n = params[0];
+    const ulong cols = params[2];
+    const ulong pitch = params[3];
+    const int lid = get_local_id(0);
+    __local long scratch[RS];
+
+    long acc = 0;
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        const ulong cell = cellOffset(i, cols, pitch);
+        acc += (long) A[cell] * (long) B[cell];
+    }
+    scratch[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s) {
+            scratch[lid] += scratch[lid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        out[get_group_id(0)] = scratch[0];
+    }
+}
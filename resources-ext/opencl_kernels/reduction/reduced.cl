@@ -0,0 +1,80 @@
+//Tree reduction of a REAL (float, or double with -D REAL=double) buffer, params = {n, op, cols, pitch} with op one
+//of 0 sum, 1 product, 2 min, 3 max, and cols and pitch the row length and
+//row pitch of a buffer matrix (both n for an array). Each work-group folds a
+//grid-stride slice of 'in' into one value per work-item, then halves that set
+//in local memory until one value is left, written to out[group]. Run once over the input
+//with many groups, then once with a single group over the partials.
+//Launch with local size RS (a power of two) and global size a multiple of it
+#ifndef REAL
+#define REAL float
+#endif
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+#ifdef cl_khr_fp16
+#pragma OPENCL EXTENSION cl_khr_fp16 : enable
+#endif
+#ifndef RS
+#define RS 256
+#endif
+
+//the first pass over a half precision buffer is built with -D HALF_IN, which
+//reads the input through vload_half so the arithmetic stays in REAL
+#ifdef HALF_IN
+#define IN_T half
+#define LOAD(p, i) vload_half(i, p)
+#else
+#define IN_T REAL
+#define LOAD(p, i) (p)[i]
+#endif
+
+REAL identityd(ulong op) {
+    switch (op) {
+        case 1: return 1.0f;
+        case 2: return INFINITY;
+        case 3: return -INFINITY;
+        default: return 0.0f;
+    }
+}
+
+REAL combined(REAL a, REAL b, ulong op) {
+    switch (op) {
+        case 1: return a * b;
+        case 2: return fmin(a, b);
+        case 3: return fmax(a, b);
+        default: return a + b;
+    }
+}
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void reduced( __global const long unsigned int* params, __global const IN_T* in, __global REAL* out ) {
+    const ulong n = params[0];
+    const ulong op = params[1];
+    const ulong cols = params[2];
+    const ulong pitch = params[3];
+    const int lid = get_local_id(0);
+    __local REAL scratch[RS];
+
+    REAL acc = identityd(op);
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        acc = combined(acc, LOAD(in, cellOffset(i, cols, pitch)), op);
+    }
+    scratch[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s) {
+            scratch[lid] = combined(scratch[lid], scratch[lid + s], op);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        out[get_group_id(0)] = scratch[0];
+    }
+}
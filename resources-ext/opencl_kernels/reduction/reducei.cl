@@ -0,0 +1,61 @@
+//As reduced.cl for int buffers, whose cells are signed 64 bit unless built with INT_T
+#ifndef RS
+#define RS 256
+#endif
+
+//the first pass over a buffer of another element type is built with, e.g.,
+//-D INT_T=char; the arithmetic stays in long
+#ifndef INT_T
+#define INT_T long
+#endif
+
+long identityi(ulong op) {
+    switch (op) {
+        case 1: return 1;
+        case 2: return LONG_MAX;
+        case 3: return LONG_MIN;
+        default: return 0;
+    }
+}
+
+long combinei(long a, long b, ulong op) {
+    switch (op) {
+        case 1: return a * b;
+        case 2: return min(a, b);
+        case 3: return max(a, b);
+        default: return a + b;
+    }
+}
+
+//offset of the i'th cell in row order, skipping the padding at the end of
+//each row of a buffer matrix. Arrays and partials pass cols == pitch
+ulong cellOffset(ulong i, ulong cols, ulong pitch) {
+    return cols == pitch ? i : (i / cols) * pitch + i % cols;
+}
+
+__kernel void reducei( __global const long unsigned int* params, __global const INT_T* in, __global long* out ) {
+    const ulong n = params[0];
+    const ulong op = params[1];
+    const ulong cols = params[2];
+    const ulong pitch = params[3];
+    const int lid = get_local_id(0);
+    __local long scratch[RS];
+
+    long acc = identityi(op);
+    for (ulong i = get_global_id(0); i < n; i += get_global_size(0)) {
+        acc = combinei(acc, (long) in[cellOffset(i, cols, pitch)], op);
+    }
+    scratch[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (int s = RS / 2; s > 0; s >>= 1) {
+        if (lid < s) {
+            scratch[lid] = combinei(scratch[lid], scratch[lid + s], op);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0) {
+        out[get_group_id(0)] = scratch[0];
+    }
+}